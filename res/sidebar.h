@@ -1,5109 +0,0 @@
-/*
-  sidebar.h (rgb).
-*/
-static const uint8_t sideBar[] =
-  {
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x17, 0x46, 0x52, 0x17, 0x47, 0x52, 0x17, 0x47, 0x52, 0x17, 0x47, 0x52,
-    0x17, 0x47, 0x52, 0x17, 0x47, 0x52, 0x17, 0x47, 0x52, 0x17, 0x47, 0x52,
-    0x17, 0x47, 0x52, 0x17, 0x47, 0x52, 0x17, 0x47, 0x52, 0x17, 0x48, 0x53,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56,
-    0x17, 0x47, 0x53, 0x17, 0x47, 0x52, 0x17, 0x47, 0x52, 0x17, 0x47, 0x52,
-    0x17, 0x47, 0x52, 0x17, 0x47, 0x52, 0x17, 0x47, 0x52, 0x17, 0x47, 0x52,
-    0x17, 0x47, 0x52, 0x17, 0x47, 0x52, 0x17, 0x47, 0x52, 0x17, 0x46, 0x52,
-    0x17, 0x48, 0x54, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56, 0x16, 0x41, 0x4C,
-    0x17, 0x4A, 0x57, 0x1D, 0x67, 0x7C, 0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x83,
-    0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x83,
-    0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x82, 0x1D, 0x68, 0x7C,
-    0x1A, 0x5A, 0x6B, 0x17, 0x48, 0x54, 0x17, 0x48, 0x54, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x52,
-    0x17, 0x47, 0x54, 0x1B, 0x5C, 0x6E, 0x1D, 0x6A, 0x7F, 0x1E, 0x6D, 0x83,
-    0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x83,
-    0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x83, 0x1E, 0x6D, 0x83,
-    0x1D, 0x68, 0x7D, 0x17, 0x4D, 0x5B, 0x17, 0x46, 0x52, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x16, 0x45, 0x50, 0x13, 0x37, 0x41,
-    0x11, 0x2F, 0x37, 0x1C, 0x66, 0x7A, 0x24, 0x86, 0xA2, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x1F, 0x71, 0x88, 0x16, 0x46, 0x52,
-    0x18, 0x4A, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x15, 0x3E, 0x48,
-    0x14, 0x3D, 0x48, 0x1F, 0x6F, 0x86, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x24, 0x86, 0xA2, 0x1D, 0x6A, 0x80, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x47, 0x52, 0x14, 0x3A, 0x44, 0x11, 0x2F, 0x37,
-    0x10, 0x2B, 0x33, 0x10, 0x2E, 0x36, 0x1D, 0x6A, 0x7F, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x83, 0x9F, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x21, 0x83, 0x9E,
-    0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x1B, 0x61, 0x74, 0x16, 0x43, 0x4E, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56, 0x15, 0x41, 0x4C, 0x12, 0x34, 0x3C,
-    0x11, 0x2E, 0x37, 0x1B, 0x60, 0x73, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x21, 0x83, 0x9E, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1E, 0x6E, 0x84,
-    0x15, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x15, 0x3E, 0x48, 0x11, 0x31, 0x39, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x2E, 0x37, 0x1E, 0x6A, 0x80,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x3A, 0x90, 0xA4, 0x50, 0x9B, 0xA9, 0x52, 0x9B, 0xA9,
-    0x4D, 0x99, 0xA8, 0x33, 0x8C, 0xA3, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0xA0, 0x22, 0x7E, 0x98, 0x17, 0x4C, 0x5A, 0x17, 0x48, 0x53,
-    0x18, 0x4B, 0x57, 0x16, 0x43, 0x4E, 0x13, 0x36, 0x3F, 0x10, 0x2D, 0x35,
-    0x10, 0x2B, 0x32, 0x16, 0x49, 0x58, 0x22, 0x80, 0x9A, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x27, 0x86, 0xA0, 0x45, 0x95, 0xA6, 0x51, 0x9B, 0xA9,
-    0x52, 0x9B, 0xA9, 0x4B, 0x98, 0xA8, 0x2B, 0x88, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1E, 0x6F, 0x85, 0x15, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x16, 0x43, 0x4E, 0x12, 0x33, 0x3C, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x2E, 0x37,
-    0x1E, 0x6B, 0x81, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x83, 0x9F, 0x39, 0x8F, 0xA4, 0x8A, 0xB8, 0xB5, 0x54, 0x9D, 0xAA,
-    0x4C, 0x99, 0xA8, 0x58, 0x9E, 0xAA, 0x83, 0xB4, 0xB4, 0x39, 0x8F, 0xA4,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1E, 0x6C, 0x82,
-    0x15, 0x40, 0x4A, 0x13, 0x39, 0x42, 0x11, 0x2E, 0x37, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x13, 0x37, 0x42, 0x20, 0x74, 0x8B, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x6B, 0xA8, 0xAF, 0x71, 0xAB, 0xB0,
-    0x4D, 0x99, 0xA8, 0x4C, 0x98, 0xA8, 0x72, 0xAC, 0xB0, 0x6B, 0xA8, 0xAF,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1E, 0x6F, 0x85, 0x15, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x49, 0x55, 0x12, 0x33, 0x3C, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x2F, 0x37, 0x1E, 0x6C, 0x82, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x49, 0x97, 0xA7, 0x7E, 0xB2, 0xB3,
-    0x1F, 0x82, 0x9E, 0x21, 0x83, 0x9E, 0x1F, 0x82, 0x9E, 0x53, 0x9C, 0xA9,
-    0x7D, 0xB1, 0xB3, 0x27, 0x86, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x83, 0x9D, 0x18, 0x51, 0x60, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1B, 0x60, 0x73, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x4E, 0x9A, 0xA8, 0x80, 0xB3, 0xB3,
-    0x28, 0x86, 0xA0, 0x20, 0x83, 0x9E, 0x1E, 0x82, 0x9E, 0x46, 0x95, 0xA7,
-    0x7F, 0xB2, 0xB3, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1F, 0x6F, 0x86, 0x15, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x11, 0x2F, 0x37, 0x1E, 0x6D, 0x83, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x49, 0x97, 0xA7,
-    0x7D, 0xB1, 0xB3, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x24, 0x84, 0x9F, 0x73, 0xAC, 0xB0, 0x5D, 0xA1, 0xAC, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x20, 0x76, 0x8E, 0x13, 0x39, 0x43,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x16, 0x49, 0x57, 0x22, 0x80, 0x9A,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x31, 0x8B, 0xA2, 0x86, 0xB6, 0xB5,
-    0x3D, 0x91, 0xA5, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x46, 0x96, 0xA7, 0x7E, 0xB2, 0xB3, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1F, 0x70, 0x86,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x53, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x2F, 0x38, 0x1E, 0x6D, 0x83,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x4A, 0x98, 0xA7, 0x7C, 0xB1, 0xB2, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x31, 0x8B, 0xA2, 0x85, 0xB5, 0xB4,
-    0x3C, 0x91, 0xA5, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x1B, 0x5E, 0x71, 0x10, 0x2D, 0x35, 0x13, 0x38, 0x42, 0x1F, 0x73, 0x8B,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x72, 0xAC, 0xB0,
-    0x5D, 0xA1, 0xAC, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x45, 0x95, 0xA6, 0x7F, 0xB2, 0xB3, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x1F, 0x70, 0x87, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x53,
-    0x11, 0x31, 0x39, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x2F, 0x38,
-    0x1E, 0x6E, 0x84, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9E, 0x4A, 0x98, 0xA8, 0x7C, 0xB1, 0xB2, 0x22, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x4C, 0x99, 0xA8, 0x7D, 0xB1, 0xB3, 0x28, 0x86, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x7F, 0x99, 0x1D, 0x67, 0x7B, 0x1F, 0x6F, 0x86,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x51, 0x9B, 0xA9,
-    0x7A, 0xB0, 0xB2, 0x26, 0x86, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x45, 0x95, 0xA6, 0x7F, 0xB2, 0xB3,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x1F, 0x71, 0x88, 0x16, 0x42, 0x4E, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x53, 0x11, 0x31, 0x39, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x30, 0x38, 0x1E, 0x6E, 0x84, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x4B, 0x98, 0xA8, 0x7C, 0xB0, 0xB2,
-    0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x6D, 0xA9, 0xAF, 0x5F, 0xA2, 0xAC,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x33, 0x8C, 0xA3,
-    0x84, 0xB5, 0xB4, 0x39, 0x8F, 0xA4, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x44, 0x95, 0xA6,
-    0x80, 0xB3, 0xB3, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1F, 0x71, 0x88, 0x16, 0x42, 0x4E,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x47, 0x53, 0x11, 0x30, 0x39, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x11, 0x30, 0x39, 0x1E, 0x6F, 0x85, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x4C, 0x98, 0xA8,
-    0x7B, 0xB0, 0xB2, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x2E, 0x8A, 0xA1,
-    0x82, 0xB4, 0xB4, 0x3F, 0x92, 0xA5, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x24, 0x85, 0x9F,
-    0x73, 0xAC, 0xB0, 0x57, 0x9E, 0xAA, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x43, 0x94, 0xA6, 0x81, 0xB3, 0xB3, 0x24, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1F, 0x72, 0x89,
-    0x16, 0x42, 0x4E, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x53, 0x11, 0x30, 0x39,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x30, 0x39, 0x1E, 0x6F, 0x86,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E,
-    0x4C, 0x99, 0xA8, 0x7A, 0xB0, 0xB2, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x47, 0x96, 0xA7, 0x7D, 0xB1, 0xB2, 0x29, 0x87, 0xA0,
-    0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E,
-    0x53, 0x9C, 0xA9, 0x75, 0xAD, 0xB1, 0x25, 0x85, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x42, 0x94, 0xA6, 0x81, 0xB3, 0xB3, 0x24, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x1F, 0x72, 0x89, 0x16, 0x43, 0x4E, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x53,
-    0x11, 0x30, 0x39, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x31, 0x3A,
-    0x1F, 0x70, 0x86, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9E, 0x4D, 0x99, 0xA8, 0x79, 0xB0, 0xB2, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x67, 0xA6, 0xAE,
-    0x63, 0xA4, 0xAD, 0x21, 0x83, 0x9F, 0x22, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x36, 0x8E, 0xA3, 0x82, 0xB4, 0xB4, 0x35, 0x8D, 0xA3, 0x22, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x42, 0x93, 0xA6, 0x82, 0xB3, 0xB3,
-    0x24, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x1F, 0x73, 0x8A, 0x16, 0x43, 0x4E, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x47, 0x52, 0x11, 0x30, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x31, 0x3A, 0x1F, 0x70, 0x87, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x4E, 0x9A, 0xA8, 0x79, 0xAF, 0xB2,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9E, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x2B, 0x88, 0xA1, 0x7A, 0xB0, 0xB2, 0x54, 0x9C, 0xAA, 0x2E, 0x8A, 0xA1,
-    0x37, 0x8E, 0xA3, 0x79, 0xAF, 0xB2, 0x4E, 0x99, 0xA8, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x41, 0x93, 0xA6,
-    0x82, 0xB4, 0xB4, 0x24, 0x85, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1F, 0x73, 0x8B, 0x16, 0x43, 0x4F,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x47, 0x52, 0x11, 0x30, 0x38, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x11, 0x31, 0x3B, 0x1F, 0x71, 0x88, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E, 0x4F, 0x9A, 0xA9,
-    0x78, 0xAF, 0xB2, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x81, 0x9C, 0x1E, 0x6F, 0x86, 0x23, 0x83, 0x9D,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x31, 0x8B, 0xA2, 0x63, 0xA4, 0xAD,
-    0x6A, 0xA8, 0xAE, 0x69, 0xA7, 0xAE, 0x49, 0x97, 0xA7, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x81, 0x9B, 0x1E, 0x70, 0x86, 0x23, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x40, 0x93, 0xA5, 0x83, 0xB4, 0xB4, 0x24, 0x85, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1F, 0x74, 0x8B,
-    0x16, 0x43, 0x4F, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x52, 0x11, 0x30, 0x38,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x32, 0x3B, 0x1F, 0x71, 0x88,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E,
-    0x50, 0x9A, 0xA9, 0x77, 0xAE, 0xB1, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x81, 0x9B, 0x18, 0x4F, 0x5F,
-    0x1F, 0x73, 0x8B, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x22, 0x83, 0x9F, 0x25, 0x85, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1E, 0x6E, 0x84, 0x19, 0x54, 0x65,
-    0x23, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x3F, 0x92, 0xA5, 0x83, 0xB4, 0xB4, 0x25, 0x85, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x20, 0x74, 0x8C, 0x16, 0x43, 0x4F, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x52,
-    0x11, 0x2F, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x32, 0x3B,
-    0x1F, 0x72, 0x89, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x83, 0x9E, 0x50, 0x9B, 0xA9, 0x77, 0xAE, 0xB1, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x81, 0x9C,
-    0x15, 0x43, 0x50, 0x18, 0x51, 0x61, 0x23, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x82, 0x9C, 0x17, 0x4A, 0x59,
-    0x17, 0x4C, 0x5A, 0x23, 0x84, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x3F, 0x92, 0xA5, 0x84, 0xB5, 0xB4,
-    0x25, 0x85, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x20, 0x75, 0x8C, 0x16, 0x43, 0x4F, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x46, 0x52, 0x11, 0x2F, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x32, 0x3C, 0x1F, 0x73, 0x8A, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E, 0x51, 0x9B, 0xA9, 0x76, 0xAE, 0xB1,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x81, 0x9B, 0x15, 0x43, 0x50, 0x11, 0x33, 0x3C, 0x1F, 0x71, 0x88,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x86, 0xA1, 0x1E, 0x6D, 0x83,
-    0x11, 0x30, 0x39, 0x17, 0x4B, 0x59, 0x23, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x3E, 0x92, 0xA5,
-    0x84, 0xB5, 0xB4, 0x25, 0x85, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x20, 0x75, 0x8D, 0x16, 0x43, 0x4F,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x46, 0x52, 0x11, 0x2F, 0x37, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x33, 0x12, 0x33, 0x3C, 0x1F, 0x73, 0x8A, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E, 0x52, 0x9C, 0xA9,
-    0x75, 0xAD, 0xB1, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x80, 0x9B, 0x15, 0x42, 0x4F, 0x10, 0x2A, 0x32,
-    0x16, 0x48, 0x55, 0x21, 0x7A, 0x93, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA0, 0x20, 0x78, 0x91,
-    0x15, 0x44, 0x51, 0x0F, 0x2A, 0x31, 0x16, 0x4A, 0x58, 0x23, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F,
-    0x3D, 0x91, 0xA5, 0x85, 0xB5, 0xB4, 0x25, 0x85, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x20, 0x76, 0x8E,
-    0x16, 0x43, 0x4F, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x46, 0x52, 0x11, 0x2F, 0x37,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x12, 0x33, 0x3D, 0x1F, 0x73, 0x8B,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E,
-    0x53, 0x9C, 0xA9, 0x75, 0xAD, 0xB1, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x80, 0x9A, 0x15, 0x41, 0x4E,
-    0x10, 0x2B, 0x32, 0x10, 0x2C, 0x34, 0x14, 0x3D, 0x49, 0x19, 0x54, 0x65,
-    0x1B, 0x5D, 0x6F, 0x1B, 0x5E, 0x70, 0x1A, 0x5C, 0x6F, 0x18, 0x53, 0x64,
-    0x13, 0x3B, 0x47, 0x10, 0x2C, 0x34, 0x10, 0x2A, 0x32, 0x16, 0x48, 0x56,
-    0x23, 0x83, 0x9D, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x83, 0x9F, 0x3D, 0x91, 0xA5, 0x85, 0xB5, 0xB4, 0x25, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x20, 0x76, 0x8E, 0x16, 0x43, 0x4F, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x46, 0x51,
-    0x11, 0x2F, 0x37, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x12, 0x33, 0x3D,
-    0x20, 0x74, 0x8C, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x83, 0x9E, 0x54, 0x9C, 0xAA, 0x74, 0xAD, 0xB1, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x7F, 0x99,
-    0x14, 0x40, 0x4D, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x32,
-    0x16, 0x47, 0x55, 0x23, 0x82, 0x9D, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x3C, 0x91, 0xA5, 0x86, 0xB6, 0xB5,
-    0x25, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x20, 0x77, 0x8F, 0x16, 0x44, 0x50, 0x18, 0x4B, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x46, 0x51, 0x11, 0x2F, 0x37, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33,
-    0x12, 0x34, 0x3D, 0x20, 0x74, 0x8C, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E, 0x54, 0x9D, 0xAA, 0x73, 0xAC, 0xB0,
-    0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x7F, 0x99, 0x14, 0x3F, 0x4C, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x32, 0x15, 0x46, 0x53, 0x22, 0x81, 0x9C, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x3C, 0x90, 0xA4,
-    0x86, 0xB6, 0xB5, 0x26, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x20, 0x77, 0x8F, 0x16, 0x44, 0x50,
-    0x18, 0x4B, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x46, 0x51, 0x11, 0x2E, 0x37, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x12, 0x34, 0x3E, 0x20, 0x75, 0x8D, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E, 0x55, 0x9D, 0xAA,
-    0x72, 0xAC, 0xB0, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x7E, 0x98, 0x14, 0x3F, 0x4B, 0x10, 0x2B, 0x32,
-    0x10, 0x2C, 0x34, 0x11, 0x32, 0x3B, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x32, 0x15, 0x44, 0x51, 0x22, 0x81, 0x9B,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F,
-    0x3B, 0x90, 0xA4, 0x86, 0xB6, 0xB5, 0x26, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x20, 0x78, 0x90,
-    0x16, 0x44, 0x50, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x45, 0x51, 0x11, 0x2E, 0x37,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x12, 0x34, 0x3E, 0x20, 0x76, 0x8D,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E,
-    0x56, 0x9E, 0xAA, 0x72, 0xAC, 0xB0, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x7E, 0x97, 0x14, 0x3E, 0x4A,
-    0x11, 0x30, 0x38, 0x14, 0x3C, 0x46, 0x17, 0x48, 0x53, 0x14, 0x3B, 0x44,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x32, 0x15, 0x43, 0x50,
-    0x22, 0x80, 0x9B, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x83, 0x9F, 0x3B, 0x90, 0xA4, 0x87, 0xB6, 0xB5, 0x26, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x20, 0x78, 0x91, 0x16, 0x44, 0x50, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x45, 0x50,
-    0x11, 0x2E, 0x37, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x12, 0x35, 0x3F,
-    0x20, 0x76, 0x8E, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x83, 0x9E, 0x51, 0x9B, 0xA9, 0x69, 0xA7, 0xAE, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0xA0, 0x21, 0x7D, 0x96,
-    0x16, 0x45, 0x52, 0x17, 0x46, 0x51, 0x18, 0x4B, 0x57, 0x18, 0x4C, 0x58,
-    0x14, 0x3B, 0x45, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x15, 0x42, 0x4E, 0x22, 0x80, 0x9A, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x38, 0x8F, 0xA4, 0x7C, 0xB1, 0xB3,
-    0x26, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x21, 0x79, 0x91, 0x16, 0x44, 0x50, 0x18, 0x4A, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x45, 0x50, 0x11, 0x2E, 0x36, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x12, 0x35, 0x3F, 0x20, 0x77, 0x8F, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x2B, 0x88, 0xA1, 0x2E, 0x8A, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0xA0,
-    0x21, 0x7C, 0x95, 0x16, 0x46, 0x53, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x14, 0x3C, 0x46, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x14, 0x40, 0x4D, 0x22, 0x7F, 0x99, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x26, 0x86, 0xA0,
-    0x32, 0x8B, 0xA2, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x21, 0x79, 0x92, 0x16, 0x44, 0x50,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x16, 0x45, 0x50, 0x11, 0x2E, 0x36, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x12, 0x35, 0x40, 0x20, 0x77, 0x90, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x21, 0x7C, 0x95, 0x16, 0x46, 0x53, 0x18, 0x4A, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x14, 0x3C, 0x47, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x14, 0x3F, 0x4B, 0x22, 0x7F, 0x99,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x21, 0x7A, 0x93,
-    0x16, 0x44, 0x50, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x16, 0x45, 0x50, 0x11, 0x2E, 0x36,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x11, 0x33, 0x3C, 0x1F, 0x72, 0x89,
-    0x23, 0x86, 0xA2, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x86, 0xA1, 0x20, 0x76, 0x8E, 0x16, 0x44, 0x50,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x15, 0x3D, 0x47,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x13, 0x3A, 0x45,
-    0x21, 0x7A, 0x93, 0x23, 0x86, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x86, 0xA1,
-    0x20, 0x75, 0x8C, 0x16, 0x43, 0x4F, 0x18, 0x4B, 0x56, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x16, 0x44, 0x50,
-    0x11, 0x2E, 0x36, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x15, 0x41, 0x4E, 0x1A, 0x5A, 0x6C, 0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71,
-    0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71,
-    0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71, 0x1A, 0x5C, 0x6E, 0x17, 0x4D, 0x5B,
-    0x17, 0x46, 0x52, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x58,
-    0x15, 0x3E, 0x48, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x36, 0x16, 0x46, 0x54, 0x1A, 0x5C, 0x6E, 0x1B, 0x5E, 0x71,
-    0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71,
-    0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71,
-    0x1A, 0x5C, 0x6E, 0x17, 0x4D, 0x5B, 0x17, 0x46, 0x52, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x16, 0x44, 0x4F, 0x10, 0x2E, 0x36, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2C, 0x33, 0x11, 0x31, 0x3A, 0x15, 0x3E, 0x48,
-    0x17, 0x48, 0x54, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4C, 0x58, 0x15, 0x3F, 0x49, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2C, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x11, 0x31, 0x3A, 0x15, 0x3E, 0x49, 0x17, 0x48, 0x54, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x16, 0x44, 0x4F, 0x10, 0x2E, 0x36, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x11, 0x30, 0x39, 0x14, 0x3C, 0x46, 0x17, 0x48, 0x53,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4C, 0x58, 0x15, 0x3F, 0x4A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x30, 0x38,
-    0x14, 0x3C, 0x46, 0x17, 0x48, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x16, 0x44, 0x4F, 0x10, 0x2E, 0x36,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x2F, 0x37, 0x13, 0x39, 0x43, 0x17, 0x46, 0x51, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4C, 0x58, 0x15, 0x40, 0x4B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x2E, 0x36, 0x13, 0x39, 0x42,
-    0x17, 0x46, 0x51, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x54,
-    0x13, 0x36, 0x3F, 0x10, 0x2D, 0x36, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35,
-    0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35,
-    0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x11, 0x2E, 0x37,
-    0x13, 0x37, 0x40, 0x16, 0x44, 0x4F, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56, 0x18, 0x49, 0x55, 0x18, 0x49, 0x55,
-    0x18, 0x49, 0x55, 0x18, 0x49, 0x55, 0x18, 0x49, 0x55, 0x18, 0x49, 0x55,
-    0x16, 0x45, 0x50, 0x11, 0x31, 0x3A, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x33,
-    0x10, 0x2D, 0x35, 0x11, 0x2E, 0x37, 0x13, 0x36, 0x3F, 0x16, 0x43, 0x4E,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x16, 0x44, 0x4F, 0x16, 0x42, 0x4C,
-    0x16, 0x41, 0x4C, 0x16, 0x41, 0x4C, 0x16, 0x41, 0x4C, 0x16, 0x41, 0x4C,
-    0x16, 0x41, 0x4C, 0x16, 0x41, 0x4C, 0x16, 0x41, 0x4C, 0x16, 0x42, 0x4D,
-    0x16, 0x45, 0x50, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4A, 0x56, 0x16, 0x45, 0x51, 0x18, 0x4C, 0x5A, 0x19, 0x54, 0x63,
-    0x19, 0x55, 0x65, 0x19, 0x55, 0x65, 0x19, 0x55, 0x65, 0x19, 0x55, 0x65,
-    0x19, 0x55, 0x65, 0x19, 0x55, 0x65, 0x18, 0x52, 0x62, 0x17, 0x4D, 0x5C,
-    0x17, 0x4C, 0x5A, 0x17, 0x4C, 0x5A, 0x17, 0x4C, 0x5A, 0x17, 0x4C, 0x5A,
-    0x17, 0x4C, 0x5A, 0x17, 0x4C, 0x5A, 0x17, 0x4C, 0x5A, 0x17, 0x4B, 0x5A,
-    0x16, 0x46, 0x54, 0x14, 0x3D, 0x48, 0x16, 0x43, 0x4D, 0x18, 0x4A, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58,
-    0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58,
-    0x18, 0x4C, 0x58, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x16, 0x45, 0x50, 0x14, 0x3A, 0x44, 0x1B, 0x5C, 0x6F, 0x22, 0x7E, 0x98,
-    0x23, 0x83, 0x9D, 0x23, 0x83, 0x9E, 0x23, 0x83, 0x9E, 0x23, 0x83, 0x9E,
-    0x23, 0x83, 0x9E, 0x23, 0x83, 0x9E, 0x23, 0x83, 0x9E, 0x23, 0x83, 0x9E,
-    0x23, 0x83, 0x9E, 0x23, 0x83, 0x9E, 0x23, 0x83, 0x9E, 0x23, 0x83, 0x9E,
-    0x23, 0x83, 0x9E, 0x23, 0x83, 0x9E, 0x23, 0x83, 0x9E, 0x23, 0x83, 0x9E,
-    0x23, 0x83, 0x9E, 0x22, 0x82, 0x9C, 0x1E, 0x6E, 0x84, 0x16, 0x46, 0x52,
-    0x18, 0x4A, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x52,
-    0x14, 0x3B, 0x45, 0x11, 0x2E, 0x36, 0x15, 0x44, 0x51, 0x22, 0x80, 0x9A,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x1B, 0x61, 0x74, 0x16, 0x43, 0x4E, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x54, 0x15, 0x3E, 0x48,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x11, 0x2F, 0x38, 0x1D, 0x68, 0x7D,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x2A, 0x88, 0xA1,
-    0x2D, 0x89, 0xA1, 0x2E, 0x89, 0xA1, 0x2E, 0x89, 0xA1, 0x2E, 0x89, 0xA1,
-    0x2E, 0x89, 0xA1, 0x2C, 0x89, 0xA1, 0x26, 0x86, 0xA0, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0xA0, 0x22, 0x7D, 0x97, 0x17, 0x4B, 0x59, 0x17, 0x48, 0x53,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56, 0x15, 0x41, 0x4B, 0x12, 0x33, 0x3C,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x16, 0x46, 0x53,
-    0x22, 0x80, 0x9A, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x3C, 0x90, 0xA4, 0x6A, 0xA8, 0xAE,
-    0x6D, 0xA9, 0xAF, 0x69, 0xA7, 0xAE, 0x68, 0xA7, 0xAE, 0x69, 0xA7, 0xAE,
-    0x69, 0xA7, 0xAE, 0x69, 0xA7, 0xAE, 0x6B, 0xA8, 0xAF, 0x72, 0xAB, 0xB0,
-    0x57, 0x9E, 0xAA, 0x26, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1D, 0x6A, 0x7F,
-    0x16, 0x43, 0x4E, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x49, 0x55, 0x13, 0x39, 0x42, 0x10, 0x2D, 0x35,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x30, 0x38,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x3F, 0x92, 0xA5, 0x80, 0xB3, 0xB3,
-    0x45, 0x95, 0xA6, 0x29, 0x87, 0xA0, 0x26, 0x85, 0xA0, 0x26, 0x85, 0xA0,
-    0x26, 0x85, 0xA0, 0x26, 0x85, 0xA0, 0x26, 0x85, 0xA0, 0x26, 0x86, 0xA0,
-    0x34, 0x8C, 0xA3, 0x74, 0xAD, 0xB1, 0x69, 0xA7, 0xAE, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x81, 0x9C, 0x18, 0x51, 0x61, 0x17, 0x46, 0x51, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x15, 0x40, 0x4A, 0x10, 0x2D, 0x35,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x16, 0x47, 0x54, 0x22, 0x80, 0x9A, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x29, 0x87, 0xA0, 0x80, 0xB3, 0xB3,
-    0x46, 0x96, 0xA7, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x29, 0x87, 0xA0, 0x81, 0xB3, 0xB4,
-    0x4C, 0x98, 0xA8, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1F, 0x72, 0x89, 0x16, 0x44, 0x50,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x34, 0x3D,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x30, 0x39, 0x1D, 0x6A, 0x7F, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x5C, 0xA1, 0xAC,
-    0x70, 0xAB, 0xB0, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x3F, 0x92, 0xA5, 0x84, 0xB5, 0xB4, 0x2D, 0x89, 0xA1, 0x22, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9E,
-    0x1A, 0x59, 0x6B, 0x16, 0x44, 0x50, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x15, 0x40, 0x4A,
-    0x10, 0x2D, 0x35, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x16, 0x48, 0x56, 0x22, 0x81, 0x9B, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x34, 0x8C, 0xA3,
-    0x87, 0xB6, 0xB5, 0x35, 0x8D, 0xA3, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1E, 0x6F, 0x86, 0x16, 0x49, 0x57,
-    0x19, 0x57, 0x68, 0x22, 0x80, 0x9A, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x66, 0xA5, 0xAE, 0x69, 0xA7, 0xAE,
-    0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x20, 0x79, 0x91, 0x16, 0x47, 0x54, 0x18, 0x49, 0x55,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x34, 0x3D, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x11, 0x30, 0x39, 0x1E, 0x6B, 0x81, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x6F, 0xAA, 0xB0, 0x5E, 0xA2, 0xAC, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x80, 0x9A, 0x16, 0x45, 0x53,
-    0x0F, 0x29, 0x31, 0x10, 0x2E, 0x36, 0x1D, 0x67, 0x7C, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x2C, 0x88, 0xA1,
-    0x83, 0xB4, 0xB4, 0x42, 0x93, 0xA6, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1C, 0x62, 0x76,
-    0x16, 0x43, 0x4E, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x15, 0x40, 0x4A, 0x10, 0x2D, 0x35, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x16, 0x49, 0x57, 0x22, 0x81, 0x9B,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x42, 0x94, 0xA6, 0x83, 0xB4, 0xB4, 0x2A, 0x88, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1E, 0x6B, 0x80,
-    0x11, 0x30, 0x39, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x16, 0x46, 0x54,
-    0x22, 0x80, 0x9A, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x49, 0x97, 0xA7, 0x80, 0xB3, 0xB3, 0x28, 0x87, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0xA0,
-    0x22, 0x7E, 0x98, 0x17, 0x4C, 0x5A, 0x17, 0x48, 0x53, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x34, 0x3D, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x11, 0x33, 0x3C, 0x1E, 0x6E, 0x84,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x26, 0x86, 0xA0, 0x7D, 0xB1, 0xB3, 0x4B, 0x98, 0xA8, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x82, 0x9C,
-    0x16, 0x4A, 0x59, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x30, 0x39, 0x1E, 0x6B, 0x81, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x70, 0xAA, 0xB0,
-    0x5E, 0xA2, 0xAC, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1E, 0x6B, 0x80, 0x16, 0x43, 0x4E,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x15, 0x40, 0x4A, 0x10, 0x2D, 0x35, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x18, 0x52, 0x62,
-    0x23, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x54, 0x9D, 0xAA, 0x77, 0xAE, 0xB1, 0x24, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x1F, 0x6F, 0x86, 0x11, 0x32, 0x3B, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x17, 0x4B, 0x5A, 0x23, 0x82, 0x9C,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F,
-    0x31, 0x8B, 0xA2, 0x86, 0xB6, 0xB5, 0x39, 0x8F, 0xA4, 0x22, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x82, 0x9C,
-    0x19, 0x53, 0x62, 0x17, 0x46, 0x51, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x33, 0x3C, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x12, 0x37, 0x41,
-    0x20, 0x75, 0x8D, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x2C, 0x88, 0xA1, 0x85, 0xB5, 0xB4, 0x3C, 0x90, 0xA4,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x83, 0x9D, 0x17, 0x4E, 0x5E, 0x10, 0x2A, 0x32, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x32, 0x11, 0x32, 0x3B,
-    0x1F, 0x6F, 0x86, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E, 0x56, 0x9D, 0xAA, 0x75, 0xAD, 0xB1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x1F, 0x72, 0x89, 0x16, 0x43, 0x4F, 0x18, 0x4A, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x15, 0x3F, 0x4A, 0x10, 0x2D, 0x35,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x18, 0x50, 0x60, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x53, 0x9C, 0xA9, 0x78, 0xAF, 0xB1,
-    0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x21, 0x79, 0x91, 0x15, 0x43, 0x50, 0x13, 0x3A, 0x45,
-    0x13, 0x3B, 0x46, 0x13, 0x3B, 0x46, 0x13, 0x3B, 0x46, 0x13, 0x3B, 0x46,
-    0x13, 0x3A, 0x45, 0x1A, 0x5C, 0x6E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x2A, 0x88, 0xA1,
-    0x88, 0xB7, 0xB5, 0x39, 0x8F, 0xA4, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x82, 0x9D, 0x18, 0x51, 0x60,
-    0x17, 0x47, 0x52, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x12, 0x33, 0x3C,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x64, 0x78, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x75, 0xAD, 0xB1,
-    0x56, 0x9E, 0xAA, 0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x82, 0x9C, 0x21, 0x7C, 0x96,
-    0x21, 0x7C, 0x96, 0x21, 0x7C, 0x96, 0x21, 0x7C, 0x96, 0x21, 0x7C, 0x96,
-    0x21, 0x7C, 0x96, 0x21, 0x7C, 0x96, 0x22, 0x7E, 0x98, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9E, 0x73, 0xAC, 0xB0, 0x58, 0x9E, 0xAA, 0x20, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1B, 0x60, 0x74, 0x16, 0x43, 0x4E, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x14, 0x3C, 0x46,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x11, 0x2F, 0x37, 0x1E, 0x6B, 0x81, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x81, 0xB3, 0xB3, 0x44, 0x95, 0xA6, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0,
-    0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x61, 0xA3, 0xAC, 0x68, 0xA7, 0xAE,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x68, 0x7C, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x46, 0x51,
-    0x11, 0x30, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x30, 0x38, 0x1E, 0x6D, 0x83,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x24, 0x85, 0x9F, 0x83, 0xB4, 0xB4, 0x46, 0x96, 0xA7, 0x27, 0x86, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x26, 0x85, 0xA0, 0x61, 0xA3, 0xAD,
-    0x6C, 0xA9, 0xAF, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x14, 0x3B, 0x45, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x30, 0x38,
-    0x1E, 0x6D, 0x83, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x8C, 0xB9, 0xB6, 0x80, 0xB2, 0xB3,
-    0x6A, 0xA7, 0xAE, 0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF,
-    0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF,
-    0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF,
-    0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF,
-    0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF, 0x69, 0xA7, 0xAE,
-    0x91, 0xBB, 0xB7, 0x6E, 0xAA, 0xAF, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4A, 0x55, 0x12, 0x34, 0x3D, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x30, 0x38, 0x1E, 0x6D, 0x83, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x24, 0x85, 0x9F, 0x83, 0xB4, 0xB4,
-    0x47, 0x96, 0xA7, 0x28, 0x86, 0xA0, 0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0,
-    0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0,
-    0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0,
-    0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0,
-    0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0, 0x2A, 0x87, 0xA0,
-    0x27, 0x86, 0xA0, 0x62, 0xA4, 0xAD, 0x6C, 0xA9, 0xAF, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x39, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x11, 0x30, 0x38, 0x1E, 0x6D, 0x83, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x24, 0x85, 0x9F,
-    0x82, 0xB4, 0xB4, 0x41, 0x93, 0xA5, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0,
-    0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5D, 0xA1, 0xAC, 0x6B, 0xA9, 0xAF,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x53, 0x11, 0x30, 0x38,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x30, 0x38, 0x1E, 0x6D, 0x83,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x24, 0x85, 0x9F, 0x82, 0xB4, 0xB4, 0x41, 0x93, 0xA5, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9E,
-    0x22, 0x7E, 0x98, 0x21, 0x7D, 0x96, 0x22, 0x7D, 0x96, 0x22, 0x7D, 0x96,
-    0x22, 0x7D, 0x96, 0x22, 0x7D, 0x96, 0x22, 0x7D, 0x96, 0x22, 0x7D, 0x96,
-    0x22, 0x7D, 0x96, 0x22, 0x81, 0x9B, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5D, 0xA1, 0xAC,
-    0x6B, 0xA9, 0xAF, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x53,
-    0x11, 0x30, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x30, 0x38,
-    0x1E, 0x6D, 0x83, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x24, 0x85, 0x9F, 0x82, 0xB4, 0xB4, 0x41, 0x93, 0xA5,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x7F, 0x99, 0x17, 0x4B, 0x59, 0x13, 0x3B, 0x46, 0x13, 0x3C, 0x47,
-    0x13, 0x3C, 0x47, 0x13, 0x3C, 0x47, 0x13, 0x3C, 0x47, 0x13, 0x3C, 0x47,
-    0x13, 0x3C, 0x47, 0x13, 0x3B, 0x46, 0x1D, 0x66, 0x7B, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x5D, 0xA1, 0xAC, 0x6B, 0xA9, 0xAF, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x47, 0x53, 0x11, 0x30, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x30, 0x38, 0x1E, 0x6D, 0x83, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x24, 0x85, 0x9F, 0x82, 0xB4, 0xB4,
-    0x41, 0x93, 0xA5, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x7E, 0x98, 0x14, 0x3E, 0x49, 0x10, 0x2A, 0x31,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x32, 0x1B, 0x60, 0x73,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x5D, 0xA1, 0xAC, 0x6C, 0xA9, 0xAF, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x47, 0x53, 0x11, 0x30, 0x38, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x11, 0x30, 0x38, 0x1E, 0x6D, 0x83, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x24, 0x85, 0x9F,
-    0x83, 0xB4, 0xB4, 0x41, 0x93, 0xA6, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x7E, 0x98, 0x14, 0x3E, 0x4A,
-    0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x1B, 0x60, 0x73, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x6C, 0xA9, 0xAF,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x53, 0x11, 0x30, 0x38,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x30, 0x38, 0x1E, 0x6D, 0x83,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x24, 0x84, 0x9F, 0x50, 0x9B, 0xA9, 0x31, 0x8B, 0xA2, 0x22, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x7E, 0x98,
-    0x14, 0x3E, 0x4A, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x1B, 0x60, 0x73, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x3F, 0x92, 0xA5,
-    0x45, 0x95, 0xA7, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x53,
-    0x11, 0x30, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x30, 0x38,
-    0x1E, 0x6D, 0x83, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x7E, 0x98, 0x15, 0x41, 0x4D, 0x10, 0x2D, 0x35, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x1B, 0x60, 0x74, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7F,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x47, 0x53, 0x11, 0x30, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x2F, 0x38, 0x1E, 0x6D, 0x82, 0x23, 0x86, 0xA2, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x22, 0x7E, 0x98, 0x16, 0x46, 0x52, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x1B, 0x5F, 0x72,
-    0x24, 0x86, 0xA2, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x86, 0xA2,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x47, 0x53, 0x11, 0x30, 0x38, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x18, 0x51, 0x61, 0x20, 0x76, 0x8E,
-    0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93,
-    0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93,
-    0x21, 0x7A, 0x93, 0x20, 0x78, 0x91, 0x1C, 0x63, 0x77, 0x15, 0x42, 0x4E,
-    0x12, 0x33, 0x3C, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x15, 0x44, 0x51, 0x1F, 0x70, 0x87, 0x21, 0x7A, 0x92, 0x21, 0x7A, 0x93,
-    0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93,
-    0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93, 0x21, 0x7A, 0x93,
-    0x20, 0x74, 0x8C, 0x18, 0x52, 0x61, 0x17, 0x46, 0x51, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x53, 0x11, 0x30, 0x38,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x12, 0x34, 0x3E, 0x12, 0x37, 0x42, 0x12, 0x38, 0x42, 0x12, 0x38, 0x42,
-    0x12, 0x38, 0x42, 0x12, 0x38, 0x42, 0x12, 0x38, 0x42, 0x12, 0x38, 0x42,
-    0x12, 0x37, 0x42, 0x13, 0x38, 0x43, 0x14, 0x3E, 0x49, 0x16, 0x44, 0x4F,
-    0x17, 0x48, 0x54, 0x12, 0x34, 0x3D, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x32, 0x3B, 0x12, 0x37, 0x41,
-    0x12, 0x38, 0x42, 0x12, 0x38, 0x42, 0x12, 0x38, 0x42, 0x12, 0x38, 0x42,
-    0x12, 0x38, 0x42, 0x12, 0x38, 0x42, 0x12, 0x37, 0x42, 0x12, 0x37, 0x42,
-    0x13, 0x3A, 0x44, 0x15, 0x40, 0x4B, 0x17, 0x46, 0x52, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x53,
-    0x11, 0x30, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x11, 0x31, 0x39, 0x15, 0x3E, 0x48, 0x17, 0x48, 0x54,
-    0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56, 0x12, 0x34, 0x3D, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34,
-    0x12, 0x35, 0x3F, 0x16, 0x43, 0x4E, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x47, 0x53, 0x11, 0x30, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x30, 0x38, 0x14, 0x3C, 0x46, 0x17, 0x47, 0x53, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x55, 0x12, 0x34, 0x3D,
-    0x10, 0x2C, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x12, 0x34, 0x3D,
-    0x15, 0x41, 0x4C, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x33, 0x3C, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x2E, 0x37,
-    0x13, 0x39, 0x43, 0x17, 0x46, 0x51, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x13, 0x38, 0x42, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x11, 0x32, 0x3A, 0x15, 0x3E, 0x49,
-    0x17, 0x49, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x16, 0x44, 0x4F,
-    0x13, 0x39, 0x43, 0x13, 0x36, 0x40, 0x13, 0x36, 0x3F, 0x13, 0x36, 0x3F,
-    0x13, 0x36, 0x3F, 0x13, 0x36, 0x3F, 0x13, 0x36, 0x40, 0x12, 0x36, 0x3F,
-    0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C, 0x13, 0x37, 0x40,
-    0x15, 0x40, 0x4B, 0x17, 0x47, 0x53, 0x17, 0x48, 0x54, 0x17, 0x48, 0x53,
-    0x17, 0x48, 0x53, 0x17, 0x48, 0x53, 0x17, 0x48, 0x53, 0x17, 0x48, 0x53,
-    0x17, 0x48, 0x53, 0x16, 0x44, 0x4F, 0x13, 0x39, 0x42, 0x12, 0x34, 0x3D,
-    0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C,
-    0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C, 0x12, 0x34, 0x3D,
-    0x12, 0x34, 0x3E, 0x13, 0x36, 0x40, 0x14, 0x3D, 0x47, 0x17, 0x48, 0x53,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x46, 0x51,
-    0x16, 0x45, 0x51, 0x1A, 0x58, 0x68, 0x1B, 0x5E, 0x70, 0x1B, 0x5E, 0x70,
-    0x1B, 0x5E, 0x71, 0x1B, 0x5F, 0x71, 0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x70,
-    0x1B, 0x5E, 0x70, 0x1B, 0x5E, 0x70, 0x1B, 0x5E, 0x70, 0x1B, 0x5E, 0x70,
-    0x1B, 0x5E, 0x70, 0x1B, 0x5E, 0x70, 0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71,
-    0x1B, 0x5E, 0x70, 0x1B, 0x5E, 0x70, 0x1B, 0x5E, 0x70, 0x1B, 0x5E, 0x70,
-    0x1B, 0x5E, 0x70, 0x1B, 0x5E, 0x70, 0x1B, 0x5C, 0x6F, 0x1A, 0x5A, 0x6C,
-    0x19, 0x56, 0x67, 0x18, 0x51, 0x60, 0x17, 0x4B, 0x59, 0x17, 0x47, 0x53,
-    0x17, 0x46, 0x52, 0x18, 0x49, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x54, 0x15, 0x3E, 0x48,
-    0x11, 0x31, 0x3A, 0x1B, 0x60, 0x73, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0xA0, 0x23, 0x84, 0x9E, 0x22, 0x82, 0x9C, 0x21, 0x7D, 0x97,
-    0x1F, 0x73, 0x8B, 0x1C, 0x63, 0x76, 0x18, 0x4E, 0x5C, 0x16, 0x44, 0x50,
-    0x18, 0x4A, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56, 0x15, 0x41, 0x4B, 0x12, 0x33, 0x3C,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7F, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F,
-    0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F,
-    0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F,
-    0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x22, 0x7F, 0x99,
-    0x1C, 0x65, 0x79, 0x16, 0x45, 0x51, 0x17, 0x48, 0x54, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x16, 0x44, 0x4F, 0x13, 0x36, 0x3F, 0x10, 0x2D, 0x35,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x2B, 0x88, 0xA1, 0x39, 0x8F, 0xA4, 0x3A, 0x8F, 0xA4,
-    0x3A, 0x8F, 0xA4, 0x3A, 0x8F, 0xA4, 0x3A, 0x8F, 0xA4, 0x3A, 0x8F, 0xA4,
-    0x3A, 0x8F, 0xA4, 0x3A, 0x8F, 0xA4, 0x3A, 0x8F, 0xA4, 0x3A, 0x8F, 0xA4,
-    0x3A, 0x8F, 0xA4, 0x3A, 0x8F, 0xA4, 0x3A, 0x8F, 0xA4, 0x39, 0x8F, 0xA4,
-    0x35, 0x8D, 0xA3, 0x2C, 0x88, 0xA1, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1E, 0x6C, 0x82, 0x16, 0x43, 0x4F,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x47, 0x52, 0x13, 0x39, 0x43, 0x11, 0x2E, 0x37, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E, 0x63, 0xA4, 0xAD, 0x82, 0xB4, 0xB4,
-    0x5F, 0xA2, 0xAC, 0x61, 0xA3, 0xAD, 0x61, 0xA3, 0xAD, 0x61, 0xA3, 0xAD,
-    0x61, 0xA3, 0xAD, 0x61, 0xA3, 0xAD, 0x61, 0xA3, 0xAD, 0x61, 0xA3, 0xAD,
-    0x61, 0xA3, 0xAD, 0x61, 0xA3, 0xAD, 0x61, 0xA3, 0xAD, 0x61, 0xA3, 0xAD,
-    0x62, 0xA4, 0xAD, 0x66, 0xA6, 0xAE, 0x6D, 0xA9, 0xAF, 0x6A, 0xA7, 0xAE,
-    0x49, 0x97, 0xA7, 0x25, 0x85, 0x9F, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x1A, 0x58, 0x69, 0x16, 0x44, 0x4F, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4A, 0x56, 0x13, 0x36, 0x3F, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA9, 0xAF,
-    0x5D, 0xA1, 0xAC, 0x1F, 0x82, 0x9E, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F,
-    0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F,
-    0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F,
-    0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x28, 0x86, 0xA0,
-    0x3C, 0x90, 0xA4, 0x6D, 0xA9, 0xAF, 0x6C, 0xA9, 0xAF, 0x28, 0x87, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1E, 0x6F, 0x85, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x24, 0x84, 0x9F, 0x70, 0xAB, 0xB0,
-    0x60, 0xA3, 0xAC, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x20, 0x77, 0x8F, 0x16, 0x44, 0x50,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x20, 0x74, 0x8C, 0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71, 0x1B, 0x5E, 0x71,
-    0x1B, 0x5F, 0x72, 0x1D, 0x68, 0x7D, 0x21, 0x7D, 0x96, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x3A, 0x90, 0xA4, 0x87, 0xB6, 0xB5, 0x28, 0x86, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x21, 0x79, 0x91,
-    0x16, 0x45, 0x51, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1B, 0x60, 0x73, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2D, 0x35, 0x17, 0x4C, 0x5B,
-    0x22, 0x81, 0x9B, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x2E, 0x89, 0xA1, 0x89, 0xB7, 0xB5, 0x2F, 0x8A, 0xA2,
-    0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x21, 0x79, 0x91, 0x16, 0x45, 0x51, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF,
-    0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1B, 0x60, 0x73, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x13, 0x38, 0x43, 0x21, 0x7B, 0x94, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x2D, 0x89, 0xA1, 0x89, 0xB7, 0xB5,
-    0x30, 0x8B, 0xA2, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x20, 0x77, 0x8F, 0x16, 0x44, 0x50, 0x18, 0x4B, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1B, 0x60, 0x73,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x13, 0x38, 0x42, 0x21, 0x7A, 0x93, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x2D, 0x89, 0xA1,
-    0x89, 0xB7, 0xB5, 0x30, 0x8B, 0xA2, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1E, 0x6D, 0x83, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1B, 0x5F, 0x72, 0x10, 0x2A, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2A, 0x32, 0x15, 0x44, 0x51, 0x22, 0x7F, 0x99,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x2E, 0x89, 0xA1, 0x89, 0xB7, 0xB5, 0x2F, 0x8A, 0xA2, 0x22, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x22, 0x82, 0x9C, 0x19, 0x54, 0x64,
-    0x17, 0x46, 0x51, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x1E, 0x6E, 0x84, 0x17, 0x4E, 0x5E, 0x17, 0x4E, 0x5E,
-    0x17, 0x4E, 0x5E, 0x18, 0x4F, 0x5F, 0x1A, 0x59, 0x6A, 0x20, 0x75, 0x8D,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x83, 0x9F, 0x35, 0x8D, 0xA3, 0x89, 0xB7, 0xB5, 0x2A, 0x87, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x7A, 0x93, 0x1A, 0x58, 0x6A,
-    0x16, 0x44, 0x4F, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF,
-    0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x1F, 0x82, 0x9E, 0x5A, 0xA0, 0xAB, 0x77, 0xAE, 0xB1,
-    0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x82, 0x9C, 0x1D, 0x69, 0x7F,
-    0x18, 0x4F, 0x5E, 0x17, 0x47, 0x53, 0x17, 0x46, 0x52, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x6C, 0xA8, 0xAF, 0x5C, 0xA0, 0xAB, 0x1E, 0x81, 0x9E, 0x21, 0x83, 0x9E,
-    0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x24, 0x85, 0x9F, 0x47, 0x96, 0xA7, 0x83, 0xB4, 0xB4,
-    0x39, 0x8F, 0xA4, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x82, 0x9D, 0x20, 0x76, 0x8E, 0x1A, 0x5A, 0x6B,
-    0x16, 0x45, 0x50, 0x18, 0x4A, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x6D, 0xA9, 0xAF, 0x7B, 0xB0, 0xB2, 0x49, 0x97, 0xA7,
-    0x4C, 0x98, 0xA8, 0x4C, 0x98, 0xA8, 0x4C, 0x98, 0xA8, 0x4C, 0x98, 0xA8,
-    0x4C, 0x98, 0xA8, 0x4C, 0x98, 0xA8, 0x4C, 0x98, 0xA8, 0x4C, 0x98, 0xA8,
-    0x4C, 0x98, 0xA8, 0x4C, 0x98, 0xA8, 0x4C, 0x98, 0xA8, 0x4D, 0x99, 0xA8,
-    0x55, 0x9D, 0xAA, 0x6B, 0xA8, 0xAF, 0x8A, 0xB8, 0xB5, 0x8C, 0xB9, 0xB6,
-    0x5B, 0xA0, 0xAB, 0x3B, 0x90, 0xA4, 0x2C, 0x88, 0xA1, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x23, 0x83, 0x9E, 0x1D, 0x67, 0x7B, 0x16, 0x44, 0x4F, 0x18, 0x4A, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6D, 0xA9, 0xAF, 0x79, 0xAF, 0xB2,
-    0x46, 0x96, 0xA7, 0x49, 0x97, 0xA7, 0x49, 0x97, 0xA7, 0x49, 0x97, 0xA7,
-    0x49, 0x97, 0xA7, 0x49, 0x97, 0xA7, 0x49, 0x97, 0xA7, 0x49, 0x97, 0xA7,
-    0x49, 0x97, 0xA7, 0x49, 0x97, 0xA7, 0x49, 0x97, 0xA7, 0x49, 0x97, 0xA7,
-    0x49, 0x97, 0xA7, 0x4D, 0x99, 0xA8, 0x52, 0x9B, 0xA9, 0x51, 0x9B, 0xA9,
-    0x4A, 0x98, 0xA7, 0x4F, 0x9A, 0xA9, 0x5C, 0xA0, 0xAB, 0x6C, 0xA9, 0xAF,
-    0x56, 0x9E, 0xAA, 0x25, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x1A, 0x5C, 0x6E,
-    0x16, 0x44, 0x4F, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF,
-    0x5C, 0xA0, 0xAB, 0x1E, 0x81, 0x9E, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9F,
-    0x2B, 0x88, 0xA1, 0x72, 0xAC, 0xB0, 0x5A, 0x9F, 0xAB, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x20, 0x78, 0x90, 0x16, 0x44, 0x50, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x3B, 0x90, 0xA4, 0x84, 0xB5, 0xB4,
-    0x27, 0x86, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x80, 0x9A, 0x17, 0x4B, 0x59, 0x17, 0x48, 0x54,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0xA0,
-    0x21, 0x78, 0x91, 0x1D, 0x68, 0x7C, 0x1D, 0x68, 0x7D, 0x1D, 0x68, 0x7D,
-    0x1D, 0x68, 0x7D, 0x1D, 0x68, 0x7D, 0x1D, 0x68, 0x7D, 0x1D, 0x68, 0x7D,
-    0x1E, 0x6E, 0x84, 0x22, 0x7F, 0x99, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x2E, 0x8A, 0xA1,
-    0x8A, 0xB8, 0xB5, 0x2E, 0x8A, 0xA1, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x81, 0x9C, 0x17, 0x4D, 0x5C,
-    0x17, 0x48, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1B, 0x60, 0x74, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x36,
-    0x10, 0x2D, 0x36, 0x10, 0x2D, 0x36, 0x10, 0x2D, 0x36, 0x10, 0x2D, 0x36,
-    0x10, 0x2D, 0x36, 0x11, 0x2F, 0x38, 0x18, 0x52, 0x62, 0x23, 0x83, 0x9D,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x2D, 0x89, 0xA1, 0x8A, 0xB8, 0xB5, 0x30, 0x8B, 0xA2, 0x22, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x81, 0x9C,
-    0x17, 0x4D, 0x5C, 0x17, 0x48, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF,
-    0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1B, 0x60, 0x73, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x32, 0x14, 0x3E, 0x4A,
-    0x22, 0x7F, 0x99, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x2D, 0x89, 0xA1, 0x89, 0xB8, 0xB5, 0x30, 0x8B, 0xA2,
-    0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x81, 0x9C, 0x17, 0x4D, 0x5C, 0x17, 0x48, 0x53, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1B, 0x60, 0x73,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x14, 0x3E, 0x4A, 0x22, 0x7E, 0x98, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x2D, 0x89, 0xA1, 0x89, 0xB8, 0xB5,
-    0x30, 0x8B, 0xA2, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x81, 0x9C, 0x17, 0x4D, 0x5C, 0x17, 0x48, 0x53,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1B, 0x60, 0x73, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x14, 0x3E, 0x4A, 0x22, 0x7E, 0x98, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x2D, 0x89, 0xA1,
-    0x8A, 0xB8, 0xB5, 0x30, 0x8B, 0xA2, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x81, 0x9C, 0x17, 0x4D, 0x5C,
-    0x17, 0x48, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6B, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1B, 0x61, 0x74, 0x11, 0x30, 0x39, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x14, 0x3E, 0x4A, 0x22, 0x7E, 0x98,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x2C, 0x89, 0xA1, 0x88, 0xB7, 0xB5, 0x30, 0x8B, 0xA2, 0x22, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x81, 0x9C,
-    0x17, 0x4D, 0x5C, 0x17, 0x48, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x3B, 0x90, 0xA4,
-    0x36, 0x8E, 0xA3, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1C, 0x62, 0x75, 0x15, 0x3E, 0x48,
-    0x11, 0x30, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x14, 0x3E, 0x4A,
-    0x22, 0x7E, 0x98, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x26, 0x86, 0xA0, 0x45, 0x95, 0xA6, 0x27, 0x86, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x81, 0x9C, 0x17, 0x4D, 0x5C, 0x17, 0x48, 0x53, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x83, 0x9F, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1C, 0x62, 0x75,
-    0x15, 0x40, 0x4A, 0x11, 0x31, 0x39, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x14, 0x3E, 0x4A, 0x22, 0x7E, 0x98, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x81, 0x9C, 0x17, 0x4D, 0x5C, 0x17, 0x48, 0x53,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x36, 0x1D, 0x67, 0x7C,
-    0x24, 0x87, 0xA2, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x86, 0xA2,
-    0x1B, 0x5F, 0x72, 0x15, 0x40, 0x4A, 0x11, 0x31, 0x39, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x14, 0x3C, 0x48, 0x22, 0x7E, 0x97, 0x23, 0x86, 0xA1,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA1, 0x22, 0x81, 0x9B, 0x17, 0x4B, 0x59,
-    0x17, 0x48, 0x54, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33,
-    0x15, 0x45, 0x52, 0x1D, 0x6A, 0x7F, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88,
-    0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88,
-    0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x70, 0x87,
-    0x1D, 0x68, 0x7D, 0x17, 0x49, 0x57, 0x16, 0x45, 0x50, 0x11, 0x31, 0x39,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x30, 0x39, 0x19, 0x57, 0x69,
-    0x1E, 0x6F, 0x85, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88,
-    0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88,
-    0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x6F, 0x86, 0x1B, 0x5E, 0x71,
-    0x16, 0x44, 0x50, 0x18, 0x4B, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x10, 0x2E, 0x37, 0x11, 0x30, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x30, 0x39, 0x11, 0x31, 0x3A,
-    0x12, 0x36, 0x40, 0x15, 0x41, 0x4B, 0x17, 0x49, 0x55, 0x17, 0x48, 0x53,
-    0x11, 0x30, 0x39, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x11, 0x30, 0x38, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x30, 0x39, 0x11, 0x32, 0x3B, 0x13, 0x3A, 0x44,
-    0x16, 0x44, 0x4F, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x10, 0x2B, 0x33, 0x11, 0x30, 0x38,
-    0x14, 0x3C, 0x46, 0x17, 0x47, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x47, 0x53, 0x11, 0x30, 0x39, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x12, 0x33, 0x3C, 0x15, 0x40, 0x4B,
-    0x18, 0x4A, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x2F, 0x37, 0x13, 0x39, 0x43,
-    0x17, 0x46, 0x51, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x53, 0x11, 0x30, 0x39, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x11, 0x31, 0x3A, 0x15, 0x3E, 0x48, 0x17, 0x49, 0x54,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56,
-    0x13, 0x37, 0x40, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33,
-    0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x13, 0x37, 0x40, 0x16, 0x44, 0x4F,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x49, 0x55, 0x12, 0x35, 0x3F,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33,
-    0x10, 0x2C, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x30, 0x38, 0x14, 0x3C, 0x46, 0x17, 0x47, 0x53, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x53, 0x15, 0x3F, 0x49, 0x14, 0x3B, 0x45,
-    0x14, 0x3B, 0x45, 0x14, 0x3B, 0x45, 0x14, 0x3B, 0x45, 0x14, 0x3B, 0x45,
-    0x14, 0x3B, 0x45, 0x13, 0x38, 0x41, 0x12, 0x36, 0x40, 0x13, 0x37, 0x41,
-    0x13, 0x37, 0x41, 0x13, 0x38, 0x42, 0x15, 0x3F, 0x4A, 0x17, 0x46, 0x52,
-    0x17, 0x48, 0x54, 0x17, 0x47, 0x53, 0x17, 0x47, 0x53, 0x17, 0x47, 0x53,
-    0x17, 0x47, 0x53, 0x17, 0x46, 0x52, 0x17, 0x48, 0x53, 0x18, 0x4B, 0x57,
-    0x17, 0x47, 0x53, 0x15, 0x3E, 0x49, 0x14, 0x3B, 0x45, 0x14, 0x3B, 0x45,
-    0x14, 0x3B, 0x45, 0x14, 0x3B, 0x45, 0x13, 0x39, 0x43, 0x12, 0x36, 0x3F,
-    0x13, 0x37, 0x40, 0x13, 0x37, 0x41, 0x13, 0x37, 0x41, 0x13, 0x37, 0x41,
-    0x13, 0x3A, 0x44, 0x15, 0x42, 0x4D, 0x17, 0x47, 0x53, 0x17, 0x48, 0x53,
-    0x17, 0x47, 0x53, 0x17, 0x47, 0x53, 0x17, 0x47, 0x53, 0x17, 0x46, 0x52,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x58,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4C, 0x58,
-    0x18, 0x4A, 0x56, 0x15, 0x40, 0x4A, 0x17, 0x4A, 0x58, 0x1E, 0x6D, 0x83,
-    0x20, 0x73, 0x8B, 0x20, 0x74, 0x8B, 0x20, 0x74, 0x8B, 0x20, 0x74, 0x8B,
-    0x1F, 0x73, 0x8A, 0x1F, 0x73, 0x8A, 0x1F, 0x73, 0x8A, 0x1F, 0x73, 0x8A,
-    0x1F, 0x73, 0x8A, 0x1F, 0x73, 0x8A, 0x1E, 0x6D, 0x83, 0x18, 0x4D, 0x5C,
-    0x17, 0x46, 0x52, 0x18, 0x4B, 0x58, 0x18, 0x4B, 0x58, 0x18, 0x4B, 0x57,
-    0x18, 0x4C, 0x58, 0x18, 0x4B, 0x57, 0x16, 0x44, 0x4F, 0x16, 0x47, 0x54,
-    0x1C, 0x65, 0x79, 0x1F, 0x72, 0x89, 0x20, 0x74, 0x8B, 0x20, 0x74, 0x8B,
-    0x20, 0x74, 0x8B, 0x20, 0x74, 0x8B, 0x20, 0x74, 0x8B, 0x1F, 0x73, 0x8A,
-    0x1F, 0x73, 0x8A, 0x1F, 0x73, 0x8A, 0x1F, 0x73, 0x8A, 0x1F, 0x72, 0x89,
-    0x19, 0x54, 0x64, 0x16, 0x43, 0x4E, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x56,
-    0x16, 0x43, 0x4E, 0x12, 0x35, 0x3F, 0x10, 0x2D, 0x35, 0x1C, 0x63, 0x77,
-    0x24, 0x87, 0xA2, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x24, 0x87, 0xA2,
-    0x1D, 0x67, 0x7B, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x47, 0x52, 0x13, 0x39, 0x43, 0x13, 0x38, 0x43,
-    0x1E, 0x6F, 0x86, 0x23, 0x86, 0xA1, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x19, 0x56, 0x67, 0x17, 0x45, 0x50, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x45, 0x51,
-    0x13, 0x38, 0x42, 0x11, 0x2E, 0x36, 0x10, 0x2C, 0x33, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x7A, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x43, 0x4E, 0x18, 0x4C, 0x58,
-    0x17, 0x48, 0x54, 0x14, 0x3D, 0x48, 0x11, 0x31, 0x39, 0x10, 0x2D, 0x35,
-    0x1A, 0x5C, 0x6E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x1E, 0x6B, 0x81, 0x16, 0x43, 0x4F, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x53, 0x14, 0x3C, 0x46,
-    0x11, 0x30, 0x38, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x38, 0x8F, 0xA4,
-    0x3D, 0x91, 0xA5, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x41, 0x4C,
-    0x15, 0x41, 0x4C, 0x12, 0x33, 0x3C, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x32,
-    0x16, 0x46, 0x53, 0x22, 0x7E, 0x98, 0x23, 0x84, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x38, 0x8F, 0xA4, 0x41, 0x93, 0xA6,
-    0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x21, 0x7B, 0x94, 0x17, 0x49, 0x57, 0x17, 0x48, 0x54,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x16, 0x42, 0x4D, 0x11, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAE, 0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7D,
-    0x12, 0x33, 0x3B, 0x10, 0x2D, 0x35, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x12, 0x35, 0x3F, 0x1F, 0x70, 0x87, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x29, 0x87, 0xA0, 0x81, 0xB3, 0xB3,
-    0x49, 0x97, 0xA7, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x83, 0x9E, 0x1A, 0x59, 0x6B, 0x16, 0x44, 0x4F,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x55, 0x12, 0x34, 0x3D,
-    0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAF, 0x20, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x68, 0x7D, 0x10, 0x2E, 0x36, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1A, 0x5B, 0x6D, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x61, 0xA3, 0xAD,
-    0x70, 0xAB, 0xB0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1E, 0x6D, 0x83, 0x16, 0x43, 0x4F,
-    0x18, 0x4B, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAF,
-    0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x68, 0x7D, 0x10, 0x2E, 0x36, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x15, 0x45, 0x52, 0x22, 0x7E, 0x98, 0x23, 0x84, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x3C, 0x91, 0xA5,
-    0x87, 0xB7, 0xB5, 0x31, 0x8B, 0xA2, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x21, 0x7C, 0x95, 0x17, 0x4B, 0x58,
-    0x17, 0x48, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC,
-    0x6A, 0xA8, 0xAF, 0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x68, 0x7D, 0x10, 0x2E, 0x36,
-    0x10, 0x2B, 0x33, 0x12, 0x34, 0x3E, 0x1F, 0x70, 0x86, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x27, 0x86, 0xA0,
-    0x7E, 0xB2, 0xB3, 0x50, 0x9B, 0xA9, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9E, 0x1A, 0x5B, 0x6D,
-    0x16, 0x44, 0x4F, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAF, 0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x68, 0x7D,
-    0x10, 0x2E, 0x36, 0x10, 0x2D, 0x35, 0x1A, 0x5A, 0x6C, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E,
-    0x5B, 0xA0, 0xAB, 0x76, 0xAE, 0xB1, 0x24, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1E, 0x6E, 0x85,
-    0x16, 0x43, 0x4F, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAF, 0x20, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x68, 0x7D, 0x10, 0x2C, 0x34, 0x15, 0x44, 0x51, 0x22, 0x7E, 0x97,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F,
-    0x38, 0x8E, 0xA4, 0x88, 0xB7, 0xB5, 0x35, 0x8D, 0xA3, 0x22, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0xA0, 0x21, 0x7C, 0x95,
-    0x17, 0x4A, 0x58, 0x17, 0x46, 0x51, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAF,
-    0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x1F, 0x74, 0x8B, 0x18, 0x53, 0x63, 0x1F, 0x72, 0x89,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x25, 0x85, 0x9F, 0x79, 0xAF, 0xB2, 0x57, 0x9E, 0xAA, 0x21, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x1F, 0x72, 0x89, 0x18, 0x51, 0x60, 0x18, 0x4D, 0x5B, 0x17, 0x47, 0x53,
-    0x17, 0x46, 0x52, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC,
-    0x6A, 0xA8, 0xAF, 0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9E, 0x55, 0x9D, 0xAA, 0x7B, 0xB0, 0xB2, 0x25, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x83, 0x9E, 0x22, 0x7F, 0x99,
-    0x20, 0x75, 0x8D, 0x1B, 0x5F, 0x72, 0x17, 0x48, 0x55, 0x17, 0x47, 0x52,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAE, 0x1F, 0x82, 0x9E, 0x22, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x33, 0x8C, 0xA2, 0x88, 0xB7, 0xB5, 0x38, 0x8F, 0xA4,
-    0x21, 0x83, 0x9F, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x20, 0x76, 0x8E,
-    0x17, 0x4D, 0x5B, 0x17, 0x46, 0x52, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x74, 0xAD, 0xB1, 0x30, 0x8B, 0xA2,
-    0x33, 0x8C, 0xA2, 0x33, 0x8C, 0xA2, 0x33, 0x8C, 0xA2, 0x33, 0x8C, 0xA2,
-    0x33, 0x8C, 0xA2, 0x33, 0x8C, 0xA2, 0x33, 0x8C, 0xA2, 0x33, 0x8C, 0xA2,
-    0x33, 0x8C, 0xA2, 0x33, 0x8C, 0xA2, 0x7D, 0xB1, 0xB3, 0x6C, 0xA9, 0xAF,
-    0x30, 0x8B, 0xA2, 0x32, 0x8C, 0xA2, 0x30, 0x8B, 0xA2, 0x2C, 0x88, 0xA1,
-    0x26, 0x85, 0xA0, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x20, 0x76, 0x8E, 0x16, 0x46, 0x52, 0x18, 0x49, 0x55,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x95, 0xBD, 0xB8,
-    0x64, 0xA5, 0xAD, 0x66, 0xA6, 0xAE, 0x66, 0xA6, 0xAE, 0x66, 0xA6, 0xAE,
-    0x66, 0xA6, 0xAE, 0x66, 0xA6, 0xAE, 0x66, 0xA6, 0xAE, 0x66, 0xA6, 0xAE,
-    0x66, 0xA6, 0xAE, 0x66, 0xA6, 0xAE, 0x67, 0xA6, 0xAE, 0x7D, 0xB1, 0xB3,
-    0x6A, 0xA8, 0xAE, 0x66, 0xA6, 0xAE, 0x67, 0xA6, 0xAE, 0x68, 0xA7, 0xAE,
-    0x6B, 0xA8, 0xAF, 0x6D, 0xA9, 0xAF, 0x63, 0xA4, 0xAD, 0x40, 0x93, 0xA5,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1A, 0x59, 0x6B,
-    0x16, 0x45, 0x50, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC,
-    0x6B, 0xA8, 0xAF, 0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x24, 0x84, 0x9F,
-    0x25, 0x85, 0x9F, 0x27, 0x86, 0xA0, 0x2F, 0x8A, 0xA2, 0x48, 0x96, 0xA7,
-    0x7A, 0xB0, 0xB2, 0x63, 0xA4, 0xAD, 0x24, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x67, 0x7C, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAF, 0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x20, 0x83, 0x9E, 0x2B, 0x88, 0xA1, 0x86, 0xB6, 0xB5, 0x45, 0x95, 0xA6,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAF, 0x20, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x81, 0x9C, 0x21, 0x7B, 0x94, 0x21, 0x7B, 0x94, 0x21, 0x7B, 0x94,
-    0x21, 0x7B, 0x94, 0x21, 0x7B, 0x94, 0x21, 0x7B, 0x94, 0x21, 0x7B, 0x95,
-    0x22, 0x80, 0x9B, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x1F, 0x82, 0x9E, 0x64, 0xA5, 0xAD,
-    0x66, 0xA6, 0xAE, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAF,
-    0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x1E, 0x6C, 0x82, 0x13, 0x3A, 0x45, 0x13, 0x39, 0x43,
-    0x13, 0x39, 0x43, 0x13, 0x39, 0x43, 0x13, 0x39, 0x43, 0x13, 0x39, 0x43,
-    0x13, 0x39, 0x44, 0x16, 0x46, 0x53, 0x20, 0x76, 0x8E, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x5D, 0xA1, 0xAC, 0x6C, 0xA9, 0xAF, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC,
-    0x6A, 0xA8, 0xAF, 0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x68, 0x7D, 0x10, 0x2D, 0x35,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x1B, 0x61, 0x75,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x5D, 0xA1, 0xAC, 0x6C, 0xA9, 0xAF, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAF, 0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x68, 0x7D,
-    0x10, 0x2E, 0x36, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x1B, 0x60, 0x73, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5D, 0xA1, 0xAC, 0x6B, 0xA9, 0xAF,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAF, 0x20, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x68, 0x7D, 0x10, 0x2E, 0x36, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x1B, 0x60, 0x73, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5D, 0xA1, 0xAC,
-    0x6B, 0xA9, 0xAF, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x6A, 0xA8, 0xAF,
-    0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x68, 0x7D, 0x10, 0x2E, 0x36, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x1B, 0x60, 0x73, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x5D, 0xA1, 0xAC, 0x6B, 0xA9, 0xAF, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x5F, 0xA2, 0xAC,
-    0x6B, 0xA9, 0xAF, 0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x68, 0x7D, 0x10, 0x2E, 0x36,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x1B, 0x60, 0x73,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x5E, 0xA2, 0xAC, 0x6C, 0xA9, 0xAF, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E,
-    0x54, 0x9D, 0xAA, 0x5F, 0xA2, 0xAC, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x68, 0x7D,
-    0x10, 0x2E, 0x36, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x1B, 0x60, 0x73, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x83, 0x9E, 0x54, 0x9D, 0xAA, 0x60, 0xA3, 0xAC,
-    0x20, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x28, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x68, 0x7D, 0x10, 0x2E, 0x36, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x1B, 0x60, 0x73, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x28, 0x87, 0xA0,
-    0x2A, 0x87, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x7A, 0x23, 0x86, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x10, 0x2E, 0x36, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x1B, 0x60, 0x74, 0x23, 0x86, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x6A, 0x7F,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x1A, 0x5B, 0x6D, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0xA0, 0x1B, 0x5F, 0x71, 0x10, 0x2D, 0x35,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x19, 0x56, 0x67,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x84, 0xA0,
-    0x1B, 0x60, 0x73, 0x16, 0x43, 0x4E, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x12, 0x34, 0x3E, 0x17, 0x4D, 0x5C,
-    0x19, 0x56, 0x67, 0x19, 0x57, 0x68, 0x19, 0x57, 0x68, 0x19, 0x57, 0x68,
-    0x19, 0x57, 0x68, 0x19, 0x57, 0x68, 0x19, 0x57, 0x68, 0x19, 0x57, 0x68,
-    0x19, 0x57, 0x67, 0x19, 0x56, 0x67, 0x18, 0x52, 0x62, 0x16, 0x44, 0x50,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x11, 0x33, 0x3C, 0x17, 0x4C, 0x5B, 0x19, 0x56, 0x67, 0x19, 0x57, 0x68,
-    0x19, 0x57, 0x68, 0x19, 0x57, 0x68, 0x19, 0x57, 0x68, 0x19, 0x57, 0x68,
-    0x19, 0x57, 0x68, 0x19, 0x57, 0x68, 0x19, 0x57, 0x67, 0x19, 0x56, 0x67,
-    0x18, 0x52, 0x62, 0x16, 0x46, 0x52, 0x18, 0x49, 0x55, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x32,
-    0x10, 0x2A, 0x32, 0x10, 0x2D, 0x35, 0x13, 0x37, 0x41, 0x16, 0x44, 0x4F,
-    0x18, 0x49, 0x55, 0x12, 0x34, 0x3D, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2D, 0x35,
-    0x13, 0x37, 0x41, 0x16, 0x44, 0x4F, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x13, 0x36, 0x3F, 0x16, 0x43, 0x4E, 0x18, 0x4B, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4A, 0x55, 0x12, 0x34, 0x3D, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x13, 0x36, 0x3F,
-    0x16, 0x43, 0x4E, 0x18, 0x4B, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x49, 0x55, 0x12, 0x33, 0x3C, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x12, 0x34, 0x3C, 0x15, 0x41, 0x4C, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56, 0x12, 0x34, 0x3D,
-    0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x12, 0x34, 0x3C, 0x15, 0x41, 0x4B,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x15, 0x3E, 0x48, 0x11, 0x30, 0x38,
-    0x10, 0x2E, 0x36, 0x10, 0x2E, 0x36, 0x10, 0x2E, 0x36, 0x10, 0x2E, 0x36,
-    0x10, 0x2E, 0x36, 0x10, 0x2E, 0x36, 0x10, 0x2E, 0x36, 0x10, 0x2D, 0x35,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x11, 0x31, 0x39,
-    0x14, 0x3D, 0x47, 0x17, 0x47, 0x53, 0x18, 0x4A, 0x56, 0x18, 0x4A, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x15, 0x3F, 0x4A, 0x11, 0x30, 0x39, 0x10, 0x2E, 0x36, 0x10, 0x2E, 0x36,
-    0x10, 0x2E, 0x36, 0x10, 0x2E, 0x36, 0x10, 0x2E, 0x36, 0x10, 0x2E, 0x36,
-    0x10, 0x2E, 0x36, 0x10, 0x2D, 0x35, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x11, 0x31, 0x39, 0x14, 0x3D, 0x47, 0x17, 0x47, 0x53,
-    0x18, 0x4A, 0x56, 0x18, 0x4A, 0x55, 0x18, 0x4A, 0x55, 0x18, 0x4A, 0x55,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x47, 0x53, 0x16, 0x44, 0x50, 0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F,
-    0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F, 0x16, 0x43, 0x4D, 0x15, 0x3E, 0x49,
-    0x16, 0x45, 0x52, 0x17, 0x4A, 0x58, 0x17, 0x4A, 0x58, 0x17, 0x4B, 0x59,
-    0x18, 0x4F, 0x5D, 0x19, 0x52, 0x60, 0x19, 0x51, 0x60, 0x18, 0x51, 0x60,
-    0x18, 0x4E, 0x5D, 0x17, 0x48, 0x55, 0x17, 0x46, 0x52, 0x18, 0x4B, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x53, 0x16, 0x45, 0x50,
-    0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F,
-    0x16, 0x44, 0x4F, 0x15, 0x3F, 0x49, 0x15, 0x42, 0x4E, 0x16, 0x49, 0x57,
-    0x17, 0x4A, 0x58, 0x17, 0x4B, 0x59, 0x18, 0x4F, 0x5D, 0x19, 0x52, 0x60,
-    0x19, 0x51, 0x60, 0x19, 0x51, 0x60, 0x19, 0x51, 0x60, 0x19, 0x51, 0x60,
-    0x18, 0x51, 0x60, 0x18, 0x4C, 0x5A, 0x16, 0x45, 0x51, 0x18, 0x4A, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4C, 0x58, 0x18, 0x4B, 0x57, 0x16, 0x44, 0x4F, 0x13, 0x37, 0x40,
-    0x1A, 0x58, 0x6A, 0x22, 0x7F, 0x99, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C,
-    0x23, 0x82, 0x9C, 0x22, 0x82, 0x9C, 0x22, 0x81, 0x9C, 0x22, 0x81, 0x9C,
-    0x22, 0x81, 0x9C, 0x22, 0x80, 0x9A, 0x20, 0x78, 0x90, 0x1B, 0x5D, 0x6F,
-    0x16, 0x45, 0x51, 0x18, 0x49, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58,
-    0x17, 0x47, 0x53, 0x14, 0x3A, 0x44, 0x15, 0x44, 0x51, 0x20, 0x78, 0x91,
-    0x22, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x22, 0x82, 0x9C,
-    0x22, 0x81, 0x9C, 0x22, 0x81, 0x9C, 0x22, 0x81, 0x9C, 0x22, 0x81, 0x9C,
-    0x22, 0x81, 0x9C, 0x22, 0x81, 0x9C, 0x22, 0x7F, 0x99, 0x1A, 0x59, 0x6B,
-    0x16, 0x44, 0x4F, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x46, 0x51, 0x13, 0x39, 0x43, 0x11, 0x2E, 0x37,
-    0x10, 0x2D, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x86, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x1E, 0x6A, 0x80, 0x16, 0x47, 0x54, 0x17, 0x48, 0x53,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x54,
-    0x15, 0x3E, 0x48, 0x11, 0x31, 0x3A, 0x10, 0x2A, 0x32, 0x17, 0x4E, 0x5D,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x86, 0xA1,
-    0x1D, 0x69, 0x7F, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x14, 0x3D, 0x47, 0x11, 0x30, 0x39, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x24, 0x84, 0x9F, 0x26, 0x85, 0xA0, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1F, 0x73, 0x8A,
-    0x17, 0x4C, 0x5A, 0x17, 0x46, 0x52, 0x18, 0x4A, 0x55, 0x15, 0x41, 0x4B,
-    0x12, 0x33, 0x3C, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x32,
-    0x17, 0x4E, 0x5D, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x24, 0x84, 0x9F, 0x24, 0x85, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x55,
-    0x15, 0x40, 0x4A, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x5C, 0xA0, 0xAB, 0x86, 0xB6, 0xB5, 0x4E, 0x9A, 0xA8,
-    0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x21, 0x7A, 0x93, 0x19, 0x53, 0x63, 0x13, 0x36, 0x40,
-    0x10, 0x2D, 0x35, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x32, 0x17, 0x4E, 0x5D, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x40, 0x93, 0xA5,
-    0x5D, 0xA1, 0xAB, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56,
-    0x14, 0x3A, 0x44, 0x10, 0x2D, 0x35, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x7A, 0xB0, 0xB2, 0x63, 0xA4, 0xAD,
-    0x7A, 0xB0, 0xB2, 0x66, 0xA6, 0xAE, 0x27, 0x86, 0xA0, 0x22, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x22, 0x7F, 0x99,
-    0x19, 0x57, 0x68, 0x11, 0x30, 0x39, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x32, 0x17, 0x4E, 0x5D, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E,
-    0x4F, 0x9A, 0xA8, 0x7A, 0xB0, 0xB2, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2,
-    0x4C, 0x99, 0xA8, 0x27, 0x86, 0xA0, 0x6B, 0xA8, 0xAF, 0x79, 0xAF, 0xB2,
-    0x32, 0x8C, 0xA2, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0xA0, 0x23, 0x83, 0x9E, 0x1C, 0x63, 0x76, 0x12, 0x35, 0x3F,
-    0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x32, 0x17, 0x4E, 0x5D,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9E, 0x4E, 0x9A, 0xA8, 0x78, 0xAF, 0xB1, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x55, 0x9D, 0xAA, 0x83, 0xB4, 0xB4, 0x43, 0x94, 0xA6, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0xA0,
-    0x1E, 0x6D, 0x83, 0x14, 0x3C, 0x48, 0x10, 0x2B, 0x33, 0x10, 0x2A, 0x32,
-    0x17, 0x4E, 0x5D, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x4E, 0x9A, 0xA8, 0x78, 0xAF, 0xB1,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x40, 0x92, 0xA5, 0x81, 0xB3, 0xB4,
-    0x58, 0x9E, 0xAB, 0x24, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x20, 0x76, 0x8E, 0x16, 0x45, 0x53,
-    0x10, 0x2A, 0x32, 0x17, 0x4E, 0x5D, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x4E, 0x9A, 0xA8,
-    0x78, 0xAF, 0xB1, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8,
-    0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x30, 0x8A, 0xA2, 0x75, 0xAD, 0xB1, 0x6C, 0xA9, 0xAF, 0x2B, 0x88, 0xA1,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x21, 0x7C, 0x96, 0x17, 0x4E, 0x5E, 0x18, 0x50, 0x60, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E,
-    0x4E, 0x9A, 0xA8, 0x78, 0xAF, 0xB1, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2,
-    0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x26, 0x86, 0xA0, 0x61, 0xA3, 0xAD,
-    0x7C, 0xB1, 0xB2, 0x37, 0x8E, 0xA3, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x22, 0x80, 0x9A, 0x20, 0x74, 0x8C,
-    0x23, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9E, 0x4E, 0x9A, 0xA8, 0x78, 0xAF, 0xB1, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x83, 0x9F, 0x4B, 0x98, 0xA8, 0x81, 0xB3, 0xB4, 0x4A, 0x97, 0xA7,
-    0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x4E, 0x9A, 0xA8, 0x78, 0xAF, 0xB1,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x38, 0x8F, 0xA4,
-    0x7C, 0xB1, 0xB2, 0x5F, 0xA2, 0xAC, 0x25, 0x85, 0xA0, 0x22, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x4E, 0x9A, 0xA8,
-    0x78, 0xAF, 0xB1, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8,
-    0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x2B, 0x88, 0xA1, 0x6C, 0xA9, 0xAF, 0x72, 0xAB, 0xB0,
-    0x2E, 0x8A, 0xA1, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E,
-    0x4E, 0x9A, 0xA8, 0x78, 0xAF, 0xB1, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2,
-    0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9E, 0x21, 0x7D, 0x97, 0x23, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x24, 0x84, 0x9F,
-    0x57, 0x9E, 0xAA, 0x7D, 0xB1, 0xB3, 0x3D, 0x91, 0xA5, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9E, 0x4E, 0x9A, 0xA8, 0x78, 0xAF, 0xB1, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x83, 0x9E, 0x19, 0x57, 0x68,
-    0x1C, 0x62, 0x76, 0x23, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x43, 0x94, 0xA6, 0x7F, 0xB2, 0xB3,
-    0x50, 0x9B, 0xA9, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x4E, 0x9A, 0xA8, 0x78, 0xAF, 0xB1,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x17, 0x4D, 0x5C, 0x11, 0x30, 0x38, 0x1A, 0x5C, 0x6F, 0x23, 0x82, 0x9C,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x32, 0x8C, 0xA2, 0x75, 0xAD, 0xB1, 0x65, 0xA5, 0xAD, 0x28, 0x87, 0xA0,
-    0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x4E, 0x9A, 0xA8,
-    0x78, 0xAF, 0xB1, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8,
-    0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x17, 0x4E, 0x5D, 0x10, 0x2A, 0x32, 0x11, 0x2F, 0x37,
-    0x19, 0x55, 0x66, 0x22, 0x7F, 0x99, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x27, 0x86, 0xA0, 0x63, 0xA4, 0xAD,
-    0x75, 0xAD, 0xB1, 0x33, 0x8C, 0xA2, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9E,
-    0x4E, 0x9A, 0xA8, 0x78, 0xAF, 0xB1, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2,
-    0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x17, 0x4E, 0x5D, 0x10, 0x2B, 0x32,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x17, 0x4D, 0x5D, 0x21, 0x7C, 0x95,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x4E, 0x9A, 0xA8, 0x7D, 0xB1, 0xB3, 0x43, 0x94, 0xA6,
-    0x1F, 0x82, 0x9E, 0x4E, 0x9A, 0xA8, 0x78, 0xAF, 0xB1, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x17, 0x4E, 0x5D,
-    0x10, 0x2B, 0x32, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x16, 0x46, 0x54, 0x20, 0x78, 0x90, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x3B, 0x90, 0xA4,
-    0x7A, 0xB0, 0xB2, 0x55, 0x9D, 0xAA, 0x4F, 0x9A, 0xA8, 0x78, 0xAF, 0xB1,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x17, 0x4E, 0x5D, 0x10, 0x2B, 0x32, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x14, 0x40, 0x4C, 0x1F, 0x73, 0x8A,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x2D, 0x89, 0xA1, 0x6B, 0xA8, 0xAF, 0x90, 0xBB, 0xB7,
-    0x7C, 0xB0, 0xB2, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8,
-    0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x17, 0x4E, 0x5D, 0x10, 0x2B, 0x32, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x13, 0x3A, 0x46, 0x1E, 0x6D, 0x83, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x71, 0xAB, 0xB0, 0x7F, 0xB2, 0xB3, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x79, 0xAF, 0xB2,
-    0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x17, 0x4E, 0x5D, 0x10, 0x2B, 0x32,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x12, 0x36, 0x40, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x83, 0x9E, 0x4D, 0x99, 0xA8, 0x78, 0xAF, 0xB1, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x79, 0xAF, 0xB2, 0x4D, 0x99, 0xA8, 0x21, 0x83, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x17, 0x4E, 0x5D,
-    0x10, 0x2B, 0x32, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2A, 0x32,
-    0x17, 0x4E, 0x5D, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x4E, 0x9A, 0xA8, 0x78, 0xAF, 0xB1,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x7B, 0xB0, 0xB2, 0x4E, 0x9A, 0xA8, 0x21, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x17, 0x4E, 0x5D, 0x10, 0x2B, 0x32, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x32, 0x17, 0x4E, 0x5D, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E, 0x4F, 0x9A, 0xA8,
-    0x7A, 0xB0, 0xB2, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x53, 0x9C, 0xA9, 0x3B, 0x90, 0xA4,
-    0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x17, 0x4E, 0x5D, 0x10, 0x2B, 0x32, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x32, 0x17, 0x4E, 0x5D, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F,
-    0x3B, 0x90, 0xA4, 0x53, 0x9C, 0xA9, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x18, 0x4F, 0x5E, 0x10, 0x2C, 0x33,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x32, 0x17, 0x4E, 0x5D,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x86, 0xA2,
-    0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0,
-    0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0,
-    0x23, 0x84, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x18, 0x52, 0x61,
-    0x12, 0x33, 0x3C, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x32,
-    0x17, 0x4E, 0x5D, 0x23, 0x84, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x84, 0xA0,
-    0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0,
-    0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0, 0x23, 0x84, 0xA0,
-    0x23, 0x86, 0xA2, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x18, 0x51, 0x60,
-    0x21, 0x79, 0x92, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97,
-    0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97,
-    0x22, 0x7D, 0x97, 0x22, 0x7E, 0x97, 0x21, 0x7D, 0x96, 0x1F, 0x71, 0x87,
-    0x16, 0x48, 0x54, 0x13, 0x38, 0x41, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x14, 0x3D, 0x48, 0x1F, 0x71, 0x88, 0x22, 0x7D, 0x97,
-    0x22, 0x7E, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97,
-    0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97,
-    0x22, 0x7D, 0x97, 0x21, 0x79, 0x92, 0x19, 0x55, 0x65, 0x16, 0x45, 0x50,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x36, 0x12, 0x37, 0x42, 0x13, 0x3C, 0x48, 0x13, 0x3C, 0x48,
-    0x13, 0x3C, 0x48, 0x13, 0x3C, 0x48, 0x13, 0x3C, 0x48, 0x13, 0x3C, 0x48,
-    0x13, 0x3C, 0x48, 0x13, 0x3C, 0x48, 0x13, 0x3C, 0x47, 0x14, 0x3F, 0x4B,
-    0x16, 0x43, 0x4F, 0x17, 0x48, 0x54, 0x13, 0x3A, 0x43, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x12, 0x33, 0x3D,
-    0x13, 0x3B, 0x47, 0x13, 0x3C, 0x48, 0x13, 0x3C, 0x48, 0x13, 0x3C, 0x48,
-    0x13, 0x3C, 0x48, 0x13, 0x3C, 0x48, 0x13, 0x3C, 0x48, 0x13, 0x3C, 0x48,
-    0x13, 0x3C, 0x47, 0x14, 0x3D, 0x49, 0x15, 0x42, 0x4E, 0x17, 0x46, 0x51,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x32, 0x10, 0x2D, 0x35, 0x13, 0x38, 0x41,
-    0x16, 0x45, 0x50, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x13, 0x3A, 0x43,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x32,
-    0x10, 0x2C, 0x33, 0x12, 0x33, 0x3C, 0x15, 0x41, 0x4B, 0x18, 0x49, 0x55,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x13, 0x36, 0x40, 0x16, 0x44, 0x4F,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x13, 0x3A, 0x43, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x12, 0x32, 0x3B, 0x15, 0x3F, 0x49, 0x18, 0x49, 0x55, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x49, 0x55, 0x12, 0x34, 0x3D,
-    0x10, 0x2B, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33,
-    0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33,
-    0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2C, 0x35, 0x12, 0x34, 0x3D, 0x15, 0x41, 0x4C, 0x18, 0x4A, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x14, 0x3D, 0x47, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33,
-    0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x33,
-    0x10, 0x2C, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x11, 0x30, 0x39,
-    0x14, 0x3C, 0x46, 0x17, 0x48, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x16, 0x44, 0x4F, 0x13, 0x38, 0x41, 0x12, 0x34, 0x3D, 0x12, 0x34, 0x3D,
-    0x12, 0x34, 0x3D, 0x12, 0x34, 0x3D, 0x12, 0x34, 0x3D, 0x12, 0x34, 0x3D,
-    0x12, 0x34, 0x3D, 0x12, 0x34, 0x3D, 0x12, 0x34, 0x3C, 0x12, 0x33, 0x3C,
-    0x12, 0x35, 0x3F, 0x15, 0x3E, 0x49, 0x17, 0x48, 0x54, 0x18, 0x4B, 0x57,
-    0x18, 0x4A, 0x56, 0x18, 0x4A, 0x56, 0x18, 0x4A, 0x56, 0x18, 0x4A, 0x56,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x56, 0x17, 0x47, 0x53, 0x14, 0x3A, 0x44,
-    0x12, 0x34, 0x3D, 0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C,
-    0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C,
-    0x12, 0x33, 0x3C, 0x12, 0x33, 0x3C, 0x12, 0x34, 0x3D, 0x14, 0x3A, 0x44,
-    0x17, 0x45, 0x51, 0x18, 0x4B, 0x56, 0x18, 0x4B, 0x56, 0x18, 0x4A, 0x56,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56,
-    0x18, 0x4A, 0x56, 0x18, 0x4A, 0x56, 0x18, 0x4A, 0x56, 0x18, 0x4A, 0x56,
-    0x18, 0x4A, 0x55, 0x16, 0x45, 0x50, 0x17, 0x47, 0x54, 0x17, 0x4A, 0x58,
-    0x17, 0x4B, 0x58, 0x17, 0x4B, 0x59, 0x18, 0x4C, 0x5A, 0x18, 0x4C, 0x59,
-    0x18, 0x4C, 0x59, 0x18, 0x4C, 0x59, 0x18, 0x4C, 0x59, 0x18, 0x4C, 0x59,
-    0x18, 0x4C, 0x59, 0x18, 0x4C, 0x59, 0x18, 0x4C, 0x59, 0x18, 0x4C, 0x59,
-    0x18, 0x4C, 0x59, 0x17, 0x4B, 0x58, 0x17, 0x4B, 0x58, 0x17, 0x4B, 0x58,
-    0x17, 0x4B, 0x58, 0x17, 0x4B, 0x58, 0x17, 0x4B, 0x58, 0x17, 0x4B, 0x58,
-    0x17, 0x4B, 0x58, 0x17, 0x4B, 0x58, 0x17, 0x4B, 0x58, 0x17, 0x4B, 0x58,
-    0x18, 0x4C, 0x59, 0x18, 0x4C, 0x59, 0x18, 0x4C, 0x59, 0x18, 0x4C, 0x59,
-    0x18, 0x4C, 0x59, 0x18, 0x4C, 0x59, 0x17, 0x4B, 0x58, 0x16, 0x46, 0x52,
-    0x18, 0x49, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x47, 0x52, 0x14, 0x3A, 0x44, 0x18, 0x50, 0x60, 0x21, 0x78, 0x91,
-    0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97,
-    0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97,
-    0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97,
-    0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97,
-    0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97,
-    0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97,
-    0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97,
-    0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x22, 0x7D, 0x97, 0x21, 0x7C, 0x96,
-    0x1D, 0x68, 0x7D, 0x16, 0x43, 0x4F, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x54,
-    0x15, 0x3E, 0x48, 0x11, 0x31, 0x39, 0x10, 0x2C, 0x34, 0x1C, 0x65, 0x79,
-    0x23, 0x86, 0xA2, 0x23, 0x84, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x22, 0x7E, 0x98, 0x16, 0x48, 0x55, 0x18, 0x49, 0x55,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56, 0x15, 0x41, 0x4B,
-    0x12, 0x33, 0x3C, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F,
-    0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F,
-    0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F,
-    0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F,
-    0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F, 0x24, 0x85, 0x9F,
-    0x24, 0x85, 0x9F, 0x24, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x7E, 0x98, 0x17, 0x48, 0x55,
-    0x18, 0x49, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x16, 0x44, 0x4F, 0x13, 0x36, 0x3F,
-    0x10, 0x2D, 0x35, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x4D, 0x99, 0xA8,
-    0x75, 0xAD, 0xB1, 0x68, 0xA6, 0xAE, 0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE,
-    0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE,
-    0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE,
-    0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE,
-    0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE, 0x68, 0xA7, 0xAE,
-    0x68, 0xA7, 0xAE, 0x69, 0xA7, 0xAE, 0x58, 0x9F, 0xAB, 0x26, 0x86, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x7E, 0x97,
-    0x16, 0x48, 0x55, 0x18, 0x49, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x15, 0x3E, 0x48, 0x11, 0x2E, 0x37,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x6D, 0xA9, 0xAF, 0x68, 0xA7, 0xAE, 0x2D, 0x89, 0xA1, 0x30, 0x8B, 0xA2,
-    0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2,
-    0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2,
-    0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2,
-    0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2,
-    0x30, 0x8B, 0xA2, 0x30, 0x8B, 0xA2, 0x31, 0x8B, 0xA2, 0x2D, 0x89, 0xA1,
-    0x24, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x7E, 0x98, 0x17, 0x48, 0x55, 0x18, 0x49, 0x55, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x49, 0x55, 0x12, 0x33, 0x3C,
-    0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x1F, 0x82, 0x9E,
-    0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0xA0, 0x22, 0x7E, 0x98, 0x16, 0x48, 0x55, 0x18, 0x49, 0x55,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E,
-    0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E,
-    0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E,
-    0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E,
-    0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E, 0x23, 0x84, 0x9E,
-    0x23, 0x84, 0x9E, 0x23, 0x83, 0x9E, 0x1F, 0x72, 0x89, 0x16, 0x44, 0x50,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF,
-    0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1D, 0x6A, 0x7F, 0x17, 0x4B, 0x5A,
-    0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A,
-    0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A,
-    0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A,
-    0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A,
-    0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A, 0x17, 0x4B, 0x5A, 0x16, 0x46, 0x53,
-    0x17, 0x48, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1A, 0x5A, 0x6D,
-    0x10, 0x2A, 0x31, 0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32,
-    0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32,
-    0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32,
-    0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32,
-    0x10, 0x2A, 0x32, 0x10, 0x2C, 0x34, 0x12, 0x35, 0x3E, 0x16, 0x42, 0x4D,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x1A, 0x5B, 0x6D, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x12, 0x34, 0x3D, 0x16, 0x42, 0x4C, 0x18, 0x4A, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0xA0, 0x20, 0x74, 0x8C, 0x1C, 0x62, 0x76, 0x1C, 0x62, 0x76,
-    0x1C, 0x62, 0x76, 0x1C, 0x62, 0x76, 0x1C, 0x62, 0x76, 0x1C, 0x62, 0x76,
-    0x1C, 0x62, 0x76, 0x1C, 0x62, 0x76, 0x1C, 0x62, 0x76, 0x1C, 0x62, 0x76,
-    0x1C, 0x62, 0x76, 0x1C, 0x62, 0x76, 0x1C, 0x62, 0x76, 0x1C, 0x62, 0x76,
-    0x1B, 0x61, 0x74, 0x18, 0x52, 0x63, 0x16, 0x42, 0x4E, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF,
-    0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x23, 0x86, 0xA1,
-    0x23, 0x86, 0xA1, 0x23, 0x86, 0xA1, 0x23, 0x86, 0xA1, 0x23, 0x86, 0xA1,
-    0x23, 0x86, 0xA1, 0x23, 0x86, 0xA1, 0x23, 0x86, 0xA1, 0x23, 0x86, 0xA1,
-    0x23, 0x86, 0xA1, 0x23, 0x86, 0xA1, 0x23, 0x86, 0xA1, 0x23, 0x86, 0xA1,
-    0x23, 0x86, 0xA1, 0x23, 0x86, 0xA1, 0x23, 0x82, 0x9D, 0x18, 0x4E, 0x5D,
-    0x17, 0x47, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x6C, 0xA8, 0xAF, 0x5C, 0xA0, 0xAC, 0x1D, 0x81, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x83, 0x9E,
-    0x19, 0x52, 0x62, 0x17, 0x46, 0x52, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x6D, 0xA9, 0xAF, 0x83, 0xB4, 0xB4, 0x54, 0x9C, 0xAA,
-    0x56, 0x9E, 0xAA, 0x56, 0x9E, 0xAA, 0x56, 0x9E, 0xAA, 0x56, 0x9E, 0xAA,
-    0x56, 0x9E, 0xAA, 0x56, 0x9E, 0xAA, 0x56, 0x9E, 0xAA, 0x56, 0x9E, 0xAA,
-    0x56, 0x9E, 0xAA, 0x56, 0x9E, 0xAA, 0x56, 0x9E, 0xAA, 0x56, 0x9E, 0xAA,
-    0x56, 0x9E, 0xAA, 0x56, 0x9E, 0xAA, 0x57, 0x9E, 0xAA, 0x51, 0x9B, 0xA9,
-    0x2B, 0x88, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x83, 0x9E, 0x19, 0x52, 0x62, 0x17, 0x47, 0x52, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6D, 0xA9, 0xAF, 0x78, 0xAF, 0xB2,
-    0x45, 0x95, 0xA6, 0x48, 0x96, 0xA7, 0x48, 0x96, 0xA7, 0x48, 0x96, 0xA7,
-    0x48, 0x96, 0xA7, 0x48, 0x96, 0xA7, 0x48, 0x96, 0xA7, 0x48, 0x96, 0xA7,
-    0x48, 0x96, 0xA7, 0x48, 0x96, 0xA7, 0x48, 0x96, 0xA7, 0x48, 0x96, 0xA7,
-    0x48, 0x96, 0xA7, 0x48, 0x96, 0xA7, 0x48, 0x96, 0xA7, 0x48, 0x96, 0xA7,
-    0x44, 0x95, 0xA6, 0x29, 0x87, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x83, 0x9E, 0x19, 0x52, 0x62, 0x17, 0x47, 0x52,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF,
-    0x5C, 0xA1, 0xAC, 0x1E, 0x81, 0x9E, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x83, 0x9E, 0x19, 0x52, 0x62,
-    0x17, 0x47, 0x52, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x21, 0x7D, 0x97,
-    0x17, 0x4B, 0x59, 0x17, 0x48, 0x54, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x1E, 0x6D, 0x83, 0x18, 0x52, 0x62, 0x18, 0x52, 0x62, 0x18, 0x52, 0x62,
-    0x18, 0x52, 0x62, 0x18, 0x52, 0x62, 0x18, 0x52, 0x62, 0x18, 0x52, 0x62,
-    0x18, 0x52, 0x62, 0x18, 0x52, 0x62, 0x18, 0x52, 0x62, 0x18, 0x52, 0x62,
-    0x18, 0x52, 0x62, 0x18, 0x52, 0x62, 0x18, 0x52, 0x62, 0x18, 0x51, 0x61,
-    0x17, 0x4B, 0x59, 0x17, 0x46, 0x51, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x1A, 0x5B, 0x6D, 0x10, 0x2A, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2B, 0x32, 0x11, 0x30, 0x39,
-    0x15, 0x3D, 0x47, 0x17, 0x48, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF,
-    0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1A, 0x5B, 0x6D, 0x10, 0x2A, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x11, 0x2E, 0x37, 0x14, 0x3A, 0x44,
-    0x17, 0x46, 0x52, 0x18, 0x4A, 0x56, 0x18, 0x4A, 0x56, 0x18, 0x4A, 0x56,
-    0x18, 0x4A, 0x56, 0x18, 0x4A, 0x56, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1C, 0x65, 0x7A,
-    0x15, 0x41, 0x4E, 0x15, 0x42, 0x4E, 0x15, 0x42, 0x4E, 0x15, 0x42, 0x4E,
-    0x15, 0x42, 0x4E, 0x15, 0x42, 0x4E, 0x15, 0x42, 0x4E, 0x15, 0x42, 0x4E,
-    0x15, 0x42, 0x4E, 0x15, 0x42, 0x4E, 0x15, 0x42, 0x4F, 0x17, 0x49, 0x57,
-    0x18, 0x4F, 0x5D, 0x18, 0x4F, 0x5D, 0x18, 0x4F, 0x5D, 0x18, 0x4F, 0x5D,
-    0x18, 0x4F, 0x5D, 0x18, 0x4F, 0x5D, 0x18, 0x4F, 0x5D, 0x18, 0x4D, 0x5B,
-    0x17, 0x46, 0x52, 0x17, 0x48, 0x54, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x82, 0x9D, 0x22, 0x80, 0x9B, 0x22, 0x80, 0x9B, 0x22, 0x80, 0x9B,
-    0x22, 0x80, 0x9B, 0x22, 0x80, 0x9B, 0x22, 0x80, 0x9B, 0x22, 0x80, 0x9B,
-    0x22, 0x80, 0x9B, 0x22, 0x80, 0x9B, 0x22, 0x80, 0x9B, 0x22, 0x80, 0x9B,
-    0x22, 0x80, 0x9A, 0x22, 0x80, 0x9A, 0x22, 0x80, 0x9A, 0x22, 0x80, 0x9A,
-    0x22, 0x80, 0x9A, 0x22, 0x80, 0x9A, 0x22, 0x80, 0x9A, 0x22, 0x80, 0x9A,
-    0x22, 0x7F, 0x99, 0x1E, 0x6C, 0x82, 0x16, 0x43, 0x4F, 0x18, 0x4A, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6C, 0xA8, 0xAF, 0x5D, 0xA1, 0xAC,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x22, 0x7E, 0x98, 0x16, 0x48, 0x55,
-    0x18, 0x49, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x6D, 0xA9, 0xAF,
-    0x63, 0xA4, 0xAD, 0x26, 0x85, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x28, 0x86, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x7E, 0x98,
-    0x17, 0x48, 0x55, 0x18, 0x49, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9F,
-    0x56, 0x9E, 0xAA, 0x7E, 0xB2, 0xB3, 0x69, 0xA7, 0xAE, 0x6A, 0xA8, 0xAF,
-    0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF,
-    0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF,
-    0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF,
-    0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF,
-    0x6A, 0xA8, 0xAF, 0x6A, 0xA8, 0xAF, 0x6B, 0xA8, 0xAF, 0x5A, 0xA0, 0xAB,
-    0x26, 0x86, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x7E, 0x97, 0x16, 0x48, 0x55, 0x18, 0x49, 0x55, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x79,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x24, 0x85, 0x9F, 0x28, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0, 0x29, 0x87, 0xA0,
-    0x28, 0x86, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x7E, 0x98, 0x17, 0x48, 0x55, 0x18, 0x49, 0x55,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35,
-    0x1C, 0x65, 0x7A, 0x23, 0x86, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x22, 0x7E, 0x98, 0x16, 0x48, 0x55,
-    0x18, 0x49, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x33, 0x18, 0x53, 0x63, 0x22, 0x7F, 0x98, 0x23, 0x82, 0x9C,
-    0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C,
-    0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C,
-    0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C,
-    0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C,
-    0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C,
-    0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C,
-    0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C,
-    0x23, 0x82, 0x9C, 0x23, 0x82, 0x9C, 0x22, 0x81, 0x9B, 0x1E, 0x6E, 0x85,
-    0x16, 0x44, 0x50, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x11, 0x2F, 0x38, 0x14, 0x3E, 0x4A,
-    0x15, 0x45, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53,
-    0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53,
-    0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53,
-    0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53,
-    0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53,
-    0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53,
-    0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x46, 0x53,
-    0x16, 0x46, 0x53, 0x16, 0x46, 0x53, 0x16, 0x45, 0x53, 0x16, 0x46, 0x54,
-    0x16, 0x45, 0x51, 0x17, 0x48, 0x54, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x32, 0x3B,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2D, 0x35, 0x13, 0x37, 0x40,
-    0x16, 0x44, 0x4F, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x13, 0x36, 0x3F, 0x16, 0x43, 0x4E,
-    0x18, 0x4B, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4A, 0x55, 0x12, 0x34, 0x3D, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33,
-    0x10, 0x2C, 0x34, 0x12, 0x34, 0x3C, 0x15, 0x41, 0x4B, 0x18, 0x4A, 0x56,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x16, 0x42, 0x4D, 0x12, 0x35, 0x3E,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x12, 0x34, 0x3D, 0x15, 0x3E, 0x49, 0x18, 0x49, 0x55, 0x18, 0x4C, 0x58,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4A, 0x56, 0x17, 0x48, 0x54, 0x17, 0x48, 0x54, 0x17, 0x48, 0x54,
-    0x17, 0x48, 0x54, 0x17, 0x48, 0x54, 0x17, 0x48, 0x54, 0x17, 0x48, 0x54,
-    0x17, 0x48, 0x54, 0x17, 0x48, 0x54, 0x17, 0x48, 0x54, 0x17, 0x48, 0x54,
-    0x17, 0x48, 0x54, 0x17, 0x47, 0x53, 0x17, 0x46, 0x51, 0x16, 0x45, 0x50,
-    0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F,
-    0x16, 0x44, 0x50, 0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F,
-    0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F,
-    0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F, 0x16, 0x44, 0x4F,
-    0x16, 0x44, 0x50, 0x17, 0x46, 0x51, 0x17, 0x47, 0x53, 0x17, 0x47, 0x53,
-    0x17, 0x47, 0x53, 0x17, 0x47, 0x53, 0x17, 0x47, 0x53, 0x17, 0x47, 0x52,
-    0x17, 0x47, 0x52, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x47, 0x53, 0x17, 0x47, 0x53, 0x18, 0x4C, 0x5A, 0x19, 0x55, 0x65,
-    0x1B, 0x5E, 0x70, 0x1C, 0x65, 0x79, 0x1D, 0x6A, 0x7F, 0x1E, 0x6C, 0x82,
-    0x1E, 0x6D, 0x83, 0x1E, 0x6E, 0x84, 0x1E, 0x6E, 0x84, 0x1E, 0x6E, 0x84,
-    0x1E, 0x6E, 0x84, 0x1E, 0x6E, 0x84, 0x1E, 0x6E, 0x84, 0x1E, 0x6E, 0x84,
-    0x1E, 0x6E, 0x84, 0x1E, 0x6E, 0x84, 0x1E, 0x6E, 0x84, 0x1E, 0x6E, 0x84,
-    0x1E, 0x6E, 0x84, 0x1E, 0x6E, 0x84, 0x1E, 0x6E, 0x84, 0x1E, 0x6D, 0x84,
-    0x1E, 0x6D, 0x84, 0x1E, 0x6D, 0x84, 0x1E, 0x6D, 0x84, 0x1E, 0x6D, 0x84,
-    0x1E, 0x6C, 0x81, 0x1A, 0x59, 0x6A, 0x16, 0x44, 0x4F, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x47, 0x52,
-    0x17, 0x48, 0x54, 0x1A, 0x5A, 0x6C, 0x1F, 0x70, 0x87, 0x22, 0x7D, 0x97,
-    0x23, 0x83, 0x9E, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x86, 0xA1, 0x22, 0x7F, 0x99, 0x16, 0x48, 0x55,
-    0x18, 0x49, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x54, 0x15, 0x40, 0x4A,
-    0x18, 0x51, 0x60, 0x20, 0x75, 0x8D, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x80, 0x9A,
-    0x17, 0x4A, 0x58, 0x17, 0x49, 0x54, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56, 0x15, 0x41, 0x4C, 0x12, 0x34, 0x3D,
-    0x18, 0x4F, 0x5F, 0x22, 0x7F, 0x99, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x83, 0x9F,
-    0x2E, 0x89, 0xA1, 0x40, 0x93, 0xA5, 0x4C, 0x99, 0xA8, 0x51, 0x9B, 0xA9,
-    0x51, 0x9B, 0xA9, 0x51, 0x9B, 0xA9, 0x51, 0x9B, 0xA9, 0x51, 0x9B, 0xA9,
-    0x51, 0x9B, 0xA9, 0x51, 0x9B, 0xA9, 0x51, 0x9B, 0xA9, 0x51, 0x9B, 0xA9,
-    0x51, 0x9B, 0xA9, 0x51, 0x9B, 0xA9, 0x51, 0x9B, 0xA9, 0x51, 0x9B, 0xA9,
-    0x51, 0x9B, 0xA9, 0x51, 0x9B, 0xA9, 0x52, 0x9C, 0xA9, 0x48, 0x97, 0xA7,
-    0x26, 0x86, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x80, 0x9A, 0x17, 0x4A, 0x58, 0x17, 0x49, 0x54, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x16, 0x44, 0x4F, 0x13, 0x37, 0x40, 0x10, 0x2C, 0x34,
-    0x13, 0x3B, 0x47, 0x21, 0x79, 0x92, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x2D, 0x89, 0xA1,
-    0x63, 0xA4, 0xAD, 0x72, 0xAC, 0xB0, 0x61, 0xA3, 0xAD, 0x53, 0x9C, 0xA9,
-    0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA8,
-    0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA8,
-    0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA8,
-    0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA8, 0x4E, 0x9A, 0xA9,
-    0x46, 0x95, 0xA7, 0x26, 0x86, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x80, 0x9A, 0x17, 0x4A, 0x58, 0x17, 0x49, 0x54,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x46, 0x52, 0x13, 0x3A, 0x43, 0x11, 0x2F, 0x37, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x19, 0x56, 0x67, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x2A, 0x87, 0xA0,
-    0x7B, 0xB0, 0xB2, 0x5E, 0xA2, 0xAC, 0x2A, 0x87, 0xA0, 0x21, 0x83, 0x9F,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x20, 0x83, 0x9E, 0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x80, 0x9A, 0x17, 0x4A, 0x58,
-    0x17, 0x49, 0x54, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56,
-    0x15, 0x3F, 0x4A, 0x11, 0x31, 0x39, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x65, 0x7A, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x21, 0x83, 0x9E,
-    0x51, 0x9B, 0xA9, 0x7A, 0xB0, 0xB2, 0x21, 0x83, 0x9F, 0x22, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x86, 0xA1, 0x22, 0x7F, 0x98,
-    0x16, 0x48, 0x55, 0x18, 0x49, 0x55, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x14, 0x3D, 0x47, 0x10, 0x2D, 0x35, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x65, 0xA5, 0xAD, 0x64, 0xA5, 0xAD, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x83, 0x9E, 0x20, 0x74, 0x8C, 0x1E, 0x6B, 0x81, 0x1E, 0x6B, 0x80,
-    0x1E, 0x6B, 0x80, 0x1E, 0x6B, 0x80, 0x1E, 0x6B, 0x80, 0x1E, 0x6B, 0x80,
-    0x1E, 0x6B, 0x80, 0x1E, 0x6B, 0x80, 0x1E, 0x6B, 0x80, 0x1E, 0x6B, 0x80,
-    0x1E, 0x6B, 0x80, 0x1E, 0x6B, 0x80, 0x1E, 0x6B, 0x80, 0x1E, 0x6B, 0x80,
-    0x1E, 0x6B, 0x80, 0x1E, 0x6B, 0x80, 0x1E, 0x6B, 0x80, 0x1D, 0x69, 0x7E,
-    0x1A, 0x57, 0x69, 0x16, 0x44, 0x50, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x16, 0x44, 0x4F, 0x11, 0x2F, 0x37, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x66, 0xA6, 0xAE, 0x63, 0xA4, 0xAD,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x1E, 0x6F, 0x85, 0x12, 0x35, 0x3F, 0x10, 0x2E, 0x36,
-    0x10, 0x2E, 0x36, 0x10, 0x2E, 0x37, 0x10, 0x2E, 0x37, 0x10, 0x2E, 0x37,
-    0x10, 0x2E, 0x37, 0x10, 0x2E, 0x37, 0x10, 0x2E, 0x37, 0x10, 0x2E, 0x37,
-    0x10, 0x2E, 0x37, 0x10, 0x2E, 0x37, 0x10, 0x2E, 0x37, 0x10, 0x2E, 0x37,
-    0x10, 0x2E, 0x37, 0x10, 0x2E, 0x37, 0x10, 0x2E, 0x36, 0x11, 0x31, 0x39,
-    0x14, 0x3B, 0x44, 0x16, 0x45, 0x50, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x13, 0x39, 0x42, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x66, 0xA5, 0xAE,
-    0x63, 0xA4, 0xAD, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x1F, 0x71, 0x88, 0x13, 0x3A, 0x45,
-    0x11, 0x2F, 0x37, 0x10, 0x2D, 0x36, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32,
-    0x10, 0x2B, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x36, 0x13, 0x36, 0x40,
-    0x16, 0x44, 0x4F, 0x18, 0x4B, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x49, 0x55, 0x12, 0x33, 0x3C, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x66, 0xA6, 0xAE, 0x63, 0xA4, 0xAD, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x79, 0x91, 0x1E, 0x6D, 0x84, 0x1D, 0x69, 0x7E, 0x1C, 0x63, 0x78,
-    0x1B, 0x5E, 0x71, 0x1A, 0x59, 0x6A, 0x19, 0x53, 0x64, 0x17, 0x4E, 0x5D,
-    0x16, 0x49, 0x57, 0x15, 0x44, 0x51, 0x14, 0x40, 0x4C, 0x13, 0x3C, 0x47,
-    0x12, 0x37, 0x42, 0x11, 0x33, 0x3C, 0x11, 0x31, 0x3A, 0x14, 0x3D, 0x47,
-    0x17, 0x48, 0x53, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x68, 0x7D,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x83, 0x9E, 0x5B, 0xA0, 0xAB, 0x71, 0xAB, 0xB0, 0x1F, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x83, 0x9E, 0x22, 0x81, 0x9C, 0x22, 0x7F, 0x99,
-    0x21, 0x7D, 0x97, 0x21, 0x7A, 0x92, 0x20, 0x74, 0x8B, 0x1E, 0x6C, 0x81,
-    0x1C, 0x61, 0x75, 0x19, 0x54, 0x63, 0x17, 0x48, 0x55, 0x17, 0x46, 0x51,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x1B, 0x60, 0x74, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x31, 0x8B, 0xA2, 0x83, 0xB4, 0xB4,
-    0x4D, 0x99, 0xA8, 0x25, 0x85, 0x9F, 0x21, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x21, 0x83, 0x9E, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x22, 0x83, 0x9F,
-    0x22, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA0, 0x23, 0x82, 0x9D, 0x20, 0x78, 0x91,
-    0x1B, 0x60, 0x73, 0x16, 0x47, 0x53, 0x17, 0x47, 0x53, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2B, 0x33, 0x17, 0x4C, 0x5B, 0x23, 0x83, 0x9D, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F,
-    0x36, 0x8E, 0xA3, 0x6D, 0xA9, 0xAF, 0x6F, 0xAA, 0xAF, 0x5D, 0xA1, 0xAC,
-    0x52, 0x9C, 0xA9, 0x4B, 0x98, 0xA8, 0x46, 0x95, 0xA7, 0x3F, 0x92, 0xA5,
-    0x3A, 0x90, 0xA4, 0x35, 0x8D, 0xA3, 0x30, 0x8B, 0xA2, 0x2C, 0x89, 0xA1,
-    0x29, 0x87, 0xA0, 0x26, 0x86, 0xA0, 0x24, 0x85, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x20, 0x83, 0x9E, 0x21, 0x83, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x20, 0x74, 0x8B, 0x17, 0x4A, 0x58,
-    0x17, 0x47, 0x52, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x11, 0x33, 0x3C, 0x1E, 0x6B, 0x81,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x33, 0x8C, 0xA2,
-    0x44, 0x95, 0xA6, 0x4E, 0x9A, 0xA8, 0x54, 0x9D, 0xAA, 0x59, 0x9F, 0xAB,
-    0x5E, 0xA2, 0xAC, 0x62, 0xA4, 0xAD, 0x66, 0xA6, 0xAE, 0x69, 0xA7, 0xAE,
-    0x6B, 0xA8, 0xAF, 0x6C, 0xA9, 0xAF, 0x6B, 0xA8, 0xAF, 0x6A, 0xA8, 0xAE,
-    0x67, 0xA6, 0xAE, 0x63, 0xA4, 0xAD, 0x5D, 0xA1, 0xAC, 0x52, 0x9C, 0xA9,
-    0x3D, 0x91, 0xA5, 0x26, 0x86, 0xA0, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1F, 0x71, 0x88, 0x16, 0x44, 0x4F, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x13, 0x3A, 0x45, 0x1E, 0x6C, 0x81, 0x23, 0x84, 0x9E, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x21, 0x83, 0x9F, 0x20, 0x83, 0x9E, 0x20, 0x83, 0x9E,
-    0x21, 0x83, 0x9E, 0x21, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x24, 0x85, 0x9F, 0x27, 0x86, 0xA0, 0x2A, 0x87, 0xA0, 0x2D, 0x89, 0xA1,
-    0x31, 0x8B, 0xA2, 0x36, 0x8E, 0xA3, 0x3C, 0x90, 0xA4, 0x43, 0x94, 0xA6,
-    0x51, 0x9B, 0xA9, 0x6A, 0xA8, 0xAF, 0x76, 0xAE, 0xB1, 0x3D, 0x91, 0xA5,
-    0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x83, 0x9E, 0x19, 0x54, 0x64, 0x17, 0x46, 0x51,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x49, 0x55,
-    0x12, 0x32, 0x3B, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x11, 0x33, 0x3C, 0x18, 0x51, 0x61,
-    0x1F, 0x6F, 0x86, 0x22, 0x7F, 0x99, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x22, 0x83, 0x9F, 0x22, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x20, 0x83, 0x9E, 0x22, 0x84, 0x9F, 0x47, 0x96, 0xA7,
-    0x87, 0xB6, 0xB5, 0x32, 0x8C, 0xA2, 0x22, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1C, 0x63, 0x77,
-    0x16, 0x43, 0x4E, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x13, 0x37, 0x41, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33,
-    0x10, 0x2B, 0x33, 0x11, 0x31, 0x3A, 0x14, 0x3F, 0x4C, 0x18, 0x50, 0x60,
-    0x1B, 0x5E, 0x71, 0x1D, 0x69, 0x7E, 0x1F, 0x70, 0x87, 0x20, 0x75, 0x8D,
-    0x20, 0x78, 0x91, 0x21, 0x7C, 0x95, 0x22, 0x7E, 0x98, 0x22, 0x81, 0x9B,
-    0x23, 0x82, 0x9D, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x72, 0xAC, 0xB0, 0x59, 0x9F, 0xAB, 0x20, 0x83, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x16, 0x41, 0x4C, 0x10, 0x2D, 0x36,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x32, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x11, 0x31, 0x3A,
-    0x12, 0x33, 0x3D, 0x12, 0x36, 0x40, 0x13, 0x3A, 0x45, 0x14, 0x3E, 0x4A,
-    0x15, 0x42, 0x4F, 0x16, 0x47, 0x55, 0x17, 0x4D, 0x5C, 0x18, 0x52, 0x62,
-    0x19, 0x58, 0x69, 0x1B, 0x5E, 0x70, 0x1C, 0x63, 0x77, 0x1F, 0x71, 0x88,
-    0x23, 0x83, 0x9D, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x63, 0xA4, 0xAD, 0x65, 0xA5, 0xAD,
-    0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56,
-    0x14, 0x3A, 0x44, 0x10, 0x2C, 0x35, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32, 0x10, 0x2A, 0x32,
-    0x10, 0x2A, 0x32, 0x10, 0x2B, 0x32, 0x10, 0x2B, 0x33, 0x10, 0x2C, 0x34,
-    0x12, 0x35, 0x3F, 0x1F, 0x71, 0x88, 0x23, 0x85, 0xA0, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E, 0x63, 0xA4, 0xAD,
-    0x65, 0xA5, 0xAD, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56, 0x14, 0x3D, 0x48, 0x11, 0x30, 0x39,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x33, 0x11, 0x2F, 0x37, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A, 0x11, 0x31, 0x3A,
-    0x11, 0x31, 0x3A, 0x13, 0x3C, 0x47, 0x1F, 0x74, 0x8B, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x20, 0x82, 0x9E,
-    0x63, 0xA4, 0xAD, 0x65, 0xA5, 0xAD, 0x20, 0x82, 0x9E, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1D, 0x69, 0x7E,
-    0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x46, 0x52, 0x14, 0x3D, 0x47, 0x12, 0x35, 0x3E, 0x11, 0x2F, 0x37,
-    0x10, 0x2C, 0x33, 0x15, 0x45, 0x52, 0x1E, 0x6B, 0x80, 0x1F, 0x71, 0x88,
-    0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88,
-    0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88,
-    0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88,
-    0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88, 0x1F, 0x71, 0x88,
-    0x1F, 0x71, 0x88, 0x1F, 0x72, 0x89, 0x21, 0x7A, 0x92, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x20, 0x82, 0x9E, 0x66, 0xA6, 0xAE, 0x63, 0xA4, 0xAD, 0x20, 0x82, 0x9E,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1,
-    0x1D, 0x69, 0x7E, 0x16, 0x42, 0x4D, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4C, 0x58, 0x18, 0x4B, 0x57, 0x16, 0x42, 0x4D,
-    0x12, 0x32, 0x3B, 0x10, 0x2D, 0x36, 0x1D, 0x67, 0x7C, 0x24, 0x87, 0xA2,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x27, 0x86, 0xA0, 0x82, 0xB4, 0xB4, 0x47, 0x96, 0xA7,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x85, 0xA1, 0x1C, 0x64, 0x78, 0x16, 0x43, 0x4E, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x45, 0x51, 0x13, 0x38, 0x42,
-    0x11, 0x2E, 0x36, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E,
-    0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x83, 0x9F, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E,
-    0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E,
-    0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E,
-    0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E, 0x21, 0x83, 0x9E,
-    0x21, 0x83, 0x9E, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x22, 0x84, 0x9F,
-    0x27, 0x86, 0xA0, 0x3C, 0x91, 0xA5, 0x73, 0xAC, 0xB0, 0x67, 0xA6, 0xAE,
-    0x25, 0x85, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x19, 0x55, 0x65, 0x17, 0x45, 0x51,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x47, 0x53, 0x14, 0x3B, 0x45, 0x11, 0x30, 0x38,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36,
-    0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x22, 0x84, 0x9F, 0x3C, 0x90, 0xA4, 0x5D, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB,
-    0x5C, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB,
-    0x5C, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB,
-    0x5C, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB,
-    0x5C, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB, 0x5C, 0xA1, 0xAB, 0x5E, 0xA2, 0xAC,
-    0x64, 0xA5, 0xAD, 0x6D, 0xA9, 0xAF, 0x6B, 0xA8, 0xAF, 0x48, 0x97, 0xA7,
-    0x24, 0x85, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x1F, 0x73, 0x8B, 0x16, 0x44, 0x50,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x16, 0x41, 0x4C, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7E, 0x23, 0x85, 0xA1, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F, 0x30, 0x8B, 0xA2, 0x42, 0x94, 0xA6,
-    0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6,
-    0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6,
-    0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6,
-    0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6, 0x42, 0x94, 0xA6,
-    0x40, 0x92, 0xA5, 0x39, 0x8F, 0xA4, 0x2E, 0x89, 0xA1, 0x23, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x85, 0xA1, 0x21, 0x79, 0x91, 0x17, 0x4C, 0x5A,
-    0x17, 0x46, 0x52, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x49, 0x55, 0x12, 0x33, 0x3C, 0x10, 0x2B, 0x33,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2E, 0x36, 0x1D, 0x69, 0x7F, 0x23, 0x85, 0xA1,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x22, 0x84, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F,
-    0x21, 0x83, 0x9F, 0x21, 0x83, 0x9F, 0x22, 0x83, 0x9F, 0x23, 0x84, 0x9F,
-    0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x84, 0x9F, 0x23, 0x85, 0xA0,
-    0x23, 0x85, 0xA1, 0x22, 0x81, 0x9B, 0x1E, 0x6B, 0x81, 0x17, 0x4A, 0x58,
-    0x17, 0x46, 0x51, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2D, 0x35, 0x1C, 0x62, 0x76,
-    0x23, 0x86, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1, 0x23, 0x85, 0xA1,
-    0x23, 0x85, 0xA0, 0x23, 0x85, 0xA0, 0x23, 0x83, 0x9E, 0x22, 0x7F, 0x99,
-    0x20, 0x75, 0x8D, 0x1C, 0x63, 0x76, 0x18, 0x4E, 0x5D, 0x16, 0x44, 0x50,
-    0x17, 0x49, 0x54, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54,
-    0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33,
-    0x13, 0x39, 0x44, 0x19, 0x57, 0x68, 0x1B, 0x5E, 0x71, 0x1B, 0x5F, 0x72,
-    0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71,
-    0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71,
-    0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71,
-    0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71,
-    0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71, 0x1B, 0x5F, 0x71, 0x1B, 0x5E, 0x71,
-    0x1B, 0x5D, 0x70, 0x1A, 0x59, 0x6B, 0x19, 0x53, 0x64, 0x17, 0x4A, 0x59,
-    0x14, 0x3F, 0x4B, 0x13, 0x39, 0x43, 0x15, 0x3E, 0x48, 0x17, 0x47, 0x52,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33,
-    0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2B, 0x33, 0x10, 0x2A, 0x32,
-    0x10, 0x2D, 0x35, 0x13, 0x39, 0x42, 0x17, 0x46, 0x51, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x33, 0x10, 0x2E, 0x36,
-    0x13, 0x37, 0x41, 0x16, 0x44, 0x50, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x17, 0x48, 0x54, 0x11, 0x31, 0x3A,
-    0x10, 0x2C, 0x33, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34, 0x10, 0x2C, 0x34,
-    0x10, 0x2C, 0x33, 0x10, 0x2C, 0x34, 0x11, 0x2E, 0x36, 0x12, 0x36, 0x3F,
-    0x16, 0x42, 0x4D, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56,
-    0x14, 0x3B, 0x45, 0x11, 0x2E, 0x36, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35,
-    0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35,
-    0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35,
-    0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35,
-    0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35,
-    0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35,
-    0x10, 0x2D, 0x35, 0x10, 0x2D, 0x35, 0x10, 0x2E, 0x36, 0x11, 0x2F, 0x37,
-    0x11, 0x31, 0x3A, 0x13, 0x36, 0x3F, 0x14, 0x3C, 0x47, 0x16, 0x44, 0x4F,
-    0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4A, 0x56, 0x16, 0x45, 0x50, 0x16, 0x42, 0x4D,
-    0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D,
-    0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D,
-    0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D,
-    0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D,
-    0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D,
-    0x16, 0x42, 0x4D, 0x16, 0x42, 0x4D, 0x16, 0x43, 0x4E, 0x16, 0x44, 0x4F,
-    0x17, 0x46, 0x52, 0x17, 0x48, 0x54, 0x18, 0x4A, 0x56, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58,
-    0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58,
-    0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58,
-    0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58,
-    0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58,
-    0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58, 0x18, 0x4C, 0x58,
-    0x18, 0x4B, 0x58, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-    0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57, 0x18, 0x4B, 0x57,
-  };
-
-static const uint8_t sideBarWidth = 85;
-static const uint8_t sideBarHeight = 240;
@@ -1,4 +1,4 @@
-#include "math.h"
+#include <algorithm>
 
 #include "Apu.hpp"
 
@@ -23,13 +23,43 @@ constexpr auto DMCAddress2 = 0x4012;
 constexpr auto DMCAddress3 = 0x4013;
 constexpr auto apuControlAddress = 0x4015;
 
-constexpr auto apuFrequency = 894886.5f;
+// APU cycles run at half the CPU frequency
+constexpr uint32_t cpuFrequency = 1789773;
+
+// Samples are taken out of the blip buffer every so many CPU cycles, a bit
+// over 1 ms
+constexpr uint32_t blipFrameClocks = 2048;
 constexpr uint8_t lengthCounterTable[] = {
     0x0A, 0xFE, 0x14, 0x02, 0x28, 0x04, 0x50, 0x06,
     0xA0, 0x08, 0x3C, 0x0A, 0x0E, 0x0C, 0x1A, 0x0E,
     0x0C, 0x10, 0x18, 0x12, 0x30, 0x14, 0x60, 0x16,
     0xC0, 0x18, 0x48, 0x1A, 0x10, 0x1C, 0x20, 0x1E,
 };
+constexpr uint8_t dutyCycleSequence[4][8] = {
+    {0, 1, 0, 0, 0, 0, 0, 0}, // 12.5%
+    {0, 1, 1, 0, 0, 0, 0, 0}, // 25%
+    {0, 1, 1, 1, 1, 0, 0, 0}, // 50%
+    {1, 0, 0, 1, 1, 1, 1, 1}, // 25% negated
+};
+// Noise and DMC periods, in CPU cycles
+constexpr uint16_t noisePeriodTable[] = {
+    4, 8, 16, 32, 64, 96, 128, 160, 202, 254, 380, 508, 762, 1016, 2034, 4068,
+};
+constexpr uint16_t dmcRateTable[] = {
+    428, 380, 340, 320, 286, 254, 226, 214, 190, 160, 142, 128, 106, 84, 72, 54,
+};
+// Length counter status of pulse 1, pulse 2, triangle and noise: register
+// offsets of the halt flag and length load, and the halt flag
+constexpr uint8_t statusHaltRegisters[] = {0x00, 0x04, 0x08, 0x0C};
+constexpr uint8_t statusHaltMasks[] = {0x20, 0x20, 0x80, 0x20};
+constexpr uint8_t statusLengthRegisters[] = {0x03, 0x07, 0x0B, 0x0F};
+
+// Registers the channels are rebuilt from after the deferred log
+// overflowed, relative to $4000
+constexpr uint8_t replayStateRegisters[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x11,
+};
+
 constexpr uint8_t triangleStep[] = {
     15, 14, 13, 12, 11, 10, 9,  8,
     7,  6,  5,  4,  3,  2,  1,  0,
@@ -38,7 +68,17 @@ constexpr uint8_t triangleStep[] = {
 };
 
 Apu::Apu()
+: _blip{cpuFrequency, 44100, blipFrameClocks}
 {
+    // Reference: https://wiki.nesdev.com/w/index.php/APU_Mixer
+    _pulseTable[0] = 0.0f;
+    for (uint32_t level = 1; level < sizeof(_pulseTable) / sizeof(_pulseTable[0]); level++) {
+        _pulseTable[level] = 95.52f / (8128.0f / level + 100.0f);
+    }
+    _tndTable[0] = 0.0f;
+    for (uint32_t level = 1; level < sizeof(_tndTable) / sizeof(_tndTable[0]); level++) {
+        _tndTable[level] = 163.67f / (24329.0f / level + 100.0f);
+    }
 }
 
 Apu::~Apu()
@@ -48,16 +88,50 @@ Apu::~Apu()
 bool Apu::read(uint16_t address, uint8_t& data)
 {
     data = 0x00;
+    if (address != apuControlAddress) {
+        return true;
+    }
+
+    // Status: length counters running, DMC bytes left and its interrupt
+    if (_syncMode == ApuSyncMode::Immediate) {
+        data |= (_pulse1.lengthCounter > 0) ? 0x01 : 0x00;
+        data |= (_pulse2.lengthCounter > 0) ? 0x02 : 0x00;
+        data |= (_triangle.lengthCounter > 0) ? 0x04 : 0x00;
+        data |= (_noise.lengthCounter > 0) ? 0x08 : 0x00;
+    } else {
+        for (uint32_t channel = 0; channel < 4; channel++) {
+            data |= (_statusLengthCounters[channel] > 0) ? (1 << channel) : 0x00;
+        }
+    }
+    data |= (_dmc.bytesRemaining > 0) ? 0x10 : 0x00;
+    data |= _dmc.interruptFlag ? 0x80 : 0x00;
     return true;
 }
 
 bool Apu::write(uint16_t address, uint8_t data)
 {
-    auto lock = LockGuard{_mutex};
+    writeDmc(address, data);
+
+    if (_syncMode == ApuSyncMode::Deferred) {
+        writeStatus(address, data);
+
+        // Nobody replays the log when samples are not produced
+        if (_isSampleOutputEnabled) {
+            logEvent(address, data);
+        }
+        return true;
+    }
+
+    writeRegister(address, data);
+    return true;
+}
+
+void Apu::writeRegister(uint16_t address, uint8_t data)
+{
+    _isOutputChanged = true;
     switch (address) {
     case pulse1Address0:
         _pulse1.register0 = data;
-        _pulse1.dutyCycle = getDutyCycle(_pulse1.Register0Flag.dutyCycle);
         if (_pulse1.Register0Flag.constantEnvelopeFlag) {
             _pulse1.volume = _pulse1.Register0Flag.envelopePeriod;
         } else {
@@ -76,6 +150,7 @@ bool Apu::write(uint16_t address, uint8_t data)
         _pulse1.register3 = data;
         _pulse1.period = (static_cast<uint16_t>(_pulse1.Register3Flag.pulseTimerHigh) << 8) | (_pulse1.period & 0xFF);
         _pulse1.sweepTarget = _pulse1.period;
+        _pulse1.sequenceStep = 0;
         _pulse1.envelopeStart = true;
         if (_registers.controlFlag.pulse1Enable) {
             _pulse1.lengthCounter = lengthCounterTable[_pulse1.Register3Flag.lengthCounter];
@@ -83,7 +158,6 @@ bool Apu::write(uint16_t address, uint8_t data)
         break;
     case pulse2Address0:
         _pulse2.register0 = data;
-        _pulse2.dutyCycle = getDutyCycle(_pulse2.Register0Flag.dutyCycle);
         if (_pulse2.Register0Flag.constantEnvelopeFlag) {
             _pulse2.volume = _pulse2.Register0Flag.envelopePeriod;
         } else {
@@ -102,6 +176,7 @@ bool Apu::write(uint16_t address, uint8_t data)
         _pulse2.register3 = data;
         _pulse2.period = (static_cast<uint16_t>(_pulse2.Register3Flag.pulseTimerHigh) << 8) | (_pulse2.period & 0xFF);
         _pulse2.sweepTarget = _pulse2.period;
+        _pulse2.sequenceStep = 0;
         _pulse2.envelopeStart = true;
         if (_registers.controlFlag.pulse2Enable) {
             _pulse2.lengthCounter = lengthCounterTable[_pulse2.Register3Flag.lengthCounter];
@@ -122,6 +197,30 @@ bool Apu::write(uint16_t address, uint8_t data)
         }
         _triangle.linearCounterReload = true;
         break;
+    case noiseAddress0:
+        _noise.register0 = data;
+        if (_noise.Register0Flag.constantEnvelopeFlag) {
+            _noise.volume = _noise.Register0Flag.envelopePeriod;
+        } else {
+            _noise.envelopeDecay = 15;
+            _noise.volume = _noise.envelopeDecay;
+        }
+        break;
+    case noiseAddress1:
+        _noise.register1 = data;
+        // Timer runs on APU cycles, the table is in CPU cycles
+        _noise.period = noisePeriodTable[_noise.Register1Flag.periodIndex] / 2 - 1;
+        break;
+    case noiseAddress2:
+        _noise.register2 = data;
+        _noise.envelopeStart = true;
+        if (_registers.controlFlag.noiseEnable) {
+            _noise.lengthCounter = lengthCounterTable[_noise.Register2Flag.lengthCounter];
+        }
+        break;
+    case DMCAddress1:
+        _dmcOutput = data & 0x7F;
+        break;
     case apuControlAddress:
         _registers.control = data;
         if (!_registers.controlFlag.pulse1Enable) {
@@ -133,136 +232,337 @@ bool Apu::write(uint16_t address, uint8_t data)
         if (!_registers.controlFlag.triangleEnable) {
             _triangle.lengthCounter = 0;
         }
+        if (!_registers.controlFlag.noiseEnable) {
+            _noise.lengthCounter = 0;
+        }
         break;
     default:
         break;
     }
-
-    return true;
 }
 
 // Execute one clock cycle
 void Apu::tick()
+{
+    clockDmc();
+
+    if (_syncMode == ApuSyncMode::Deferred) {
+        clockStatus();
+
+        // Time is logged once per blip frame, the replay runs the channels
+        // up to it
+        if (_isSampleOutputEnabled) {
+            _logCycle++;
+            if ((_logCycle % (blipFrameClocks / 2)) == 0) {
+                logEvent(0, 0);
+            }
+        }
+        return;
+    }
+
+    runCycle();
+}
+
+void Apu::runCycle()
 {
     // Reference: https://wiki.nesdev.com/w/index.php/APU_Frame_Counter
     // The APU runs half the rate of CPU, so 2 CPU cycles = 1 APU cycle.
 
-    auto lock = LockGuard{_mutex};
-
     _frameCounter++;
 
     /* Mode 0: 4-Step Sequence */
     switch (_frameCounter) {
     case 3729:
         doQuarterFrame();
+        _isOutputChanged = true;
         break;
     case 7457:
         doQuarterFrame();
         doHalfFrame();
+        _isOutputChanged = true;
         break;
     case 11186:
         doQuarterFrame();
+        _isOutputChanged = true;
         break;
     case 14916:
         doQuarterFrame();
         doHalfFrame();
+        _isOutputChanged = true;
         _frameCounter = 0;
         break;
     }
+
+    // Pulse timers count APU cycles, the triangle timer counts CPU cycles
+    if (!_isSampleOutputEnabled) {
+        clockTimer(_pulse1);
+        clockTimer(_pulse2);
+        clockTimer(_noise);
+        clockTimer(_triangle);
+        clockTimer(_triangle);
+        return;
+    }
+
+    // Output steps are timed to the CPU cycle they happen at
+    _isOutputChanged |= clockTimer(_pulse1);
+    _isOutputChanged |= clockTimer(_pulse2);
+    _isOutputChanged |= clockTimer(_noise);
+    _isOutputChanged |= clockTimer(_triangle);
+    updateOutput(_blipClock);
+    _isOutputChanged |= clockTimer(_triangle);
+    updateOutput(_blipClock + 1);
+
+    _blipClock += 2;
+    if (_blipClock >= blipFrameClocks) {
+        _blip.endFrame(_blipClock);
+        _blipClock = 0;
+        outputSamples();
+        updateRateCorrection();
+    }
+}
+
+void Apu::setSampleRate(uint32_t sampleRate)
+{
+    _blip.setRates(cpuFrequency, sampleRate);
+    _blipClock = 0;
 }
 
 void Apu::reset()
 {
 }
 
-float Apu::getMixedOutput(float time)
+bool Apu::clockTimer(Pulse& pulse)
 {
-    auto lock = LockGuard{_mutex};
-    auto outputPulse1 = getPulseOutput(_pulse1, time);
-    auto outputPulse2 = getPulseOutput(_pulse2, time);
-    auto outputTriangle = getTriangleOutput(_triangle, time);
+    if (pulse.timer == 0) {
+        pulse.timer = pulse.period;
+        pulse.sequenceStep = (pulse.sequenceStep + 1) & 0x07;
+        return true;
+    }
 
-    return (outputPulse1 * 0.10f + outputPulse2 * 0.10f + outputTriangle * 0.25f) * 0.25f;
+    pulse.timer--;
+    return false;
 }
 
-float Apu::getPulseOutput(Pulse pulse, float time)
+bool Apu::clockTimer(Triangle& triangle)
 {
-    auto outputPulse = 0.0f;
-    if (pulse.lengthCounter > 0) {
-        // Period is 8 times the period because we are shifting every bit on a byte (8-bit)
-        auto period = (8.0f * static_cast<float>(pulse.period)) / apuFrequency;
-        // Amplitude is scaled to 15 since that's our maximum envelope decay (4-bit)
-        auto amplitude = static_cast<float>(pulse.volume) / 15.0f;
-        // Compute cycle percentage based from period and time and from there we
-        // know how to generate pulse wave based on the given duty cycle
-        auto cyclePercentage = (time - floor(time / period) * period) / period;
-        if (pulse.dutyCycle < 0.0f) {
-            // This is for negative duty cycle waveform
-            if (cyclePercentage <= (-1.0f * pulse.dutyCycle)) {
-                outputPulse = -1.0f * amplitude;
-            } else {
-                outputPulse = 1.0f * amplitude;
-            }
-        } else {
-            if (cyclePercentage <= pulse.dutyCycle) {
-                outputPulse = 1.0f * amplitude;
-            } else {
-                outputPulse = -1.0f * amplitude;
-            }
+    if (triangle.timer == 0) {
+        triangle.timer = triangle.period;
+        // Sequencer only moves while both counters are running
+        if ((triangle.lengthCounter > 0) && (triangle.linearCounter > 0)) {
+            triangle.sequenceStep = (triangle.sequenceStep + 1) & 0x1F;
+            return true;
         }
+        return false;
     }
 
-    return outputPulse;
+    triangle.timer--;
+    return false;
 }
 
-float Apu::getTriangleOutput(Triangle triangle, float time)
+bool Apu::clockTimer(Noise& noise)
 {
-    auto outputTriangle = 0.0f;
-    if ((_triangle.lengthCounter > 0) && (_triangle.linearCounter > 0)) {
-        // Period is 32 times the period because we have a 32-step sequence
-        auto period = (32.0f * static_cast<float>(_triangle.period)) / apuFrequency;
-        // Compute cycle percentage based from period and time
-        auto cyclePercentage = (time - floor(time / period) * period) / period;
-        // Convert cycle percentage to which step we are in triangle sequence
-        auto index = static_cast<uint8_t>(floor(cyclePercentage * 32.0f));
-        // Normalized to 1.0f and centered at zero
-        outputTriangle = (static_cast<float>(triangleStep[index]) / 15.0f) - 0.5f;
+    if (noise.timer == 0) {
+        noise.timer = noise.period;
+        // 15-bit LFSR, fed back from bit 1, or bit 6 in mode 1
+        auto tap = noise.Register1Flag.modeFlag ? 6 : 1;
+        auto feedback = (noise.shiftRegister ^ (noise.shiftRegister >> tap)) & 0x0001;
+        noise.shiftRegister = (noise.shiftRegister >> 1) | (feedback << 14);
+        return true;
     }
 
-    return outputTriangle;
+    noise.timer--;
+    return false;
 }
-float Apu::getDutyCycle(uint8_t dutyCycle)
+
+float Apu::getMixedOutput()
 {
-    auto dutyCycleValue = float{0.0f};
+    auto pulse = getPulseOutput(_pulse1) + getPulseOutput(_pulse2);
+    auto tnd = 3 * getTriangleOutput(_triangle) + 2 * getNoiseOutput(_noise) + _dmcOutput;
 
-    switch (dutyCycle) {
-    case 0x00:
-        // 12.5% waveform
-        dutyCycleValue = 0.125f;
-        break;
-    case 0x01:
-        // 25% waveform
-        dutyCycleValue = 0.250f;
-        break;
-    case 0x02:
-        // 50% waveform
-        dutyCycleValue = 0.500f;
-        break;
-    case 0x03:
-        // 25% negated waveform
-        dutyCycleValue = -0.250f;
-        break;
-    default:
-        break;
+    return _pulseTable[pulse] + _tndTable[tnd];
+}
+
+uint8_t Apu::getPulseOutput(const Pulse& pulse)
+{
+    if ((pulse.lengthCounter > 0) && dutyCycleSequence[pulse.Register0Flag.dutyCycle][pulse.sequenceStep]) {
+        return pulse.volume;
+    }
+
+    return 0;
+}
+
+uint8_t Apu::getTriangleOutput(const Triangle& triangle)
+{
+    // A silenced triangle holds its step, its sequencer just stops
+    return triangleStep[triangle.sequenceStep];
+}
+
+uint8_t Apu::getNoiseOutput(const Noise& noise)
+{
+    if ((noise.lengthCounter > 0) && !(noise.shiftRegister & 0x0001)) {
+        return noise.volume;
+    }
+
+    return 0;
+}
+
+void Apu::updateOutput(uint32_t time)
+{
+    // Only a sequencer step, register write or frame counter event can
+    // change the output
+    if (!_isOutputChanged) {
+        return;
+    }
+    _isOutputChanged = false;
+
+    auto output = getMixedOutput();
+    if (output != _output) {
+        _blip.addDelta(time, output - _output);
+        _output = output;
+    }
+}
+
+void Apu::outputSamples()
+{
+    // When nobody reads them (e.g. audio is muted or way behind) samples
+    // are dropped
+    auto count = _blip.readSamples(_frameSamples, sizeof(_frameSamples) / sizeof(_frameSamples[0]));
+    _droppedSamples += count - _samples.push(_frameSamples, count);
+}
+
+void Apu::updateRateCorrection()
+{
+    auto fill = _samples.getSize();
+    if (fill < _minBufferedSamples) {
+        _minBufferedSamples = fill;
+    }
+    if (fill > _maxBufferedSamples) {
+        _maxBufferedSamples = fill;
+    }
+
+    // Proportional to how far the average fill is from the target, full
+    // correction when empty or at twice the target
+    _averageFill += (static_cast<float>(fill) - _averageFill) / 64.0f;
+    auto correction = 0.0;
+    if (_targetSamples > 0) {
+        auto target = static_cast<float>(_targetSamples);
+        auto error = std::min(std::max((target - _averageFill) / target, -1.0f), 1.0f);
+        correction = error * APU_MAX_RATE_CORRECTION;
+    }
+
+    _blip.setRateCorrection(correction);
+    _rateCorrection = correction;
+}
+
+void Apu::logEvent(uint16_t address, uint8_t data)
+{
+    // Writes lost to a full log leave the channels wrong, once there is room
+    // again they are rebuilt from the last register values instead
+    if (_isReplayStale) {
+        logRegisterState();
+        if (_isReplayStale && (address != 0)) {
+            _droppedEvents++;
+        }
+        return;
+    }
+
+    // Time markers can go missing, the next one carries the time along
+    if (!_events.push(ApuEvent{_logCycle, address, data}) && (address != 0)) {
+        _droppedEvents++;
+        _isReplayStale = true;
+    }
+}
+
+void Apu::logRegisterState()
+{
+    constexpr uint32_t numRegisters = sizeof(replayStateRegisters) / sizeof(replayStateRegisters[0]);
+    ApuEvent events[numRegisters + 3];
+
+    // Enable first, so that length counters load, and channels whose length
+    // counter ran out meanwhile are stopped again at the end
+    auto enable = _lastRegisters[apuControlAddress - pulse1Address0];
+    auto running = uint8_t{0x00};
+    for (uint32_t channel = 0; channel < 4; channel++) {
+        running |= (_statusLengthCounters[channel] > 0) ? (1 << channel) : 0x00;
+    }
+    auto numEvents = uint32_t{0};
+    events[numEvents++] = ApuEvent{_logCycle, apuControlAddress, enable};
+    for (auto offset : replayStateRegisters) {
+        events[numEvents++] = ApuEvent{_logCycle, static_cast<uint16_t>(pulse1Address0 + offset), _lastRegisters[offset]};
     }
+    events[numEvents++] = ApuEvent{_logCycle, apuControlAddress, static_cast<uint8_t>(enable & (running | 0xF0))};
+    events[numEvents++] = ApuEvent{_logCycle, apuControlAddress, enable};
+
+    // All or nothing, only the emulation adds to the log so the room can
+    // only grow meanwhile
+    if (_events.getCapacity() - _events.getSize() >= numEvents) {
+        _events.push(events, numEvents);
+        _isReplayStale = false;
+    }
+}
 
-    return dutyCycleValue;
+void Apu::replayEvents()
+{
+    uint32_t count;
+    while ((count = _events.pop(_replayedEvents, sizeof(_replayedEvents) / sizeof(_replayedEvents[0]))) > 0) {
+        for (uint32_t index = 0; index < count; index++) {
+            // Run the channels up to the cycle the event was logged at, then
+            // apply it
+            const auto& event = _replayedEvents[index];
+            while (_replayCycle != event.cycle) {
+                runCycle();
+                _replayCycle++;
+            }
+            if (event.address != 0) {
+                writeRegister(event.address, event.data);
+            }
+        }
+    }
+}
+
+uint32_t Apu::readSamples(float* samples, uint32_t count)
+{
+    if (_syncMode == ApuSyncMode::Deferred) {
+        replayEvents();
+    }
+
+    // Running short only matters to real time outputs, the ones with a
+    // target fill
+    auto numRead = _samples.pop(samples, count);
+    if ((numRead < count) && (_targetSamples > 0)) {
+        _underruns++;
+    }
+    return numRead;
+}
+
+ApuStats Apu::getStats() const
+{
+    ApuStats stats;
+    stats.bufferedSamples = _samples.getSize();
+    stats.minBufferedSamples = std::min(_minBufferedSamples.load(), _maxBufferedSamples.load());
+    stats.maxBufferedSamples = _maxBufferedSamples;
+    stats.targetSamples = _targetSamples;
+    stats.rateCorrection = _rateCorrection;
+    stats.underruns = _underruns;
+    stats.droppedSamples = _droppedSamples;
+    stats.droppedEvents = _droppedEvents;
+    return stats;
+}
+
+void Apu::resetStats()
+{
+    _minBufferedSamples = UINT32_MAX;
+    _maxBufferedSamples = 0;
+    _underruns = 0;
+    _droppedSamples = 0;
+    _droppedEvents = 0;
 }
 
 void Apu::doQuarterFrame()
 {
     doEnvelope(_pulse1);
     doEnvelope(_pulse2);
+    doEnvelope(_noise);
     doLinearCounters(_triangle);
 }
 
@@ -271,6 +571,7 @@ void Apu::doHalfFrame()
     doLengthCounters(_pulse1, _registers.controlFlag.pulse1Enable);
     doLengthCounters(_pulse2, _registers.controlFlag.pulse2Enable);
     doLengthCounters(_triangle, _registers.controlFlag.triangleEnable);
+    doLengthCounters(_noise, _registers.controlFlag.noiseEnable);
     doSweep(_pulse1);
     doSweep(_pulse2);
 }
@@ -304,6 +605,35 @@ void Apu::doEnvelope(Pulse& pulse)
     }
 }
 
+void Apu::doEnvelope(Noise& noise)
+{
+    if (noise.envelopeStart) {
+        noise.envelopeStart = false;
+        noise.envelopeDecay = 15;
+        noise.envelopeCounter = noise.Register0Flag.envelopePeriod;
+    } else {
+        if (noise.envelopeCounter > 0) {
+            noise.envelopeCounter--;
+        } else {
+            noise.envelopeCounter = noise.Register0Flag.envelopePeriod;
+
+            if (noise.envelopeDecay > 0) {
+                noise.envelopeDecay--;
+            }
+
+            if (noise.Register0Flag.lengthCounterHalt) {
+                noise.envelopeDecay = 15;
+            }
+        }
+    }
+
+    if (noise.Register0Flag.constantEnvelopeFlag) {
+        noise.volume = noise.Register0Flag.envelopePeriod;
+    } else {
+        noise.volume = noise.envelopeDecay;
+    }
+}
+
 void Apu::doSweep(Pulse& pulse)
 {
     if (pulse.Register1Flag.sweepEnableFlag) {
@@ -353,6 +683,17 @@ void Apu::doLengthCounters(Triangle& triangle, bool enable)
     }
 }
 
+void Apu::doLengthCounters(Noise& noise, bool enable)
+{
+    if (noise.lengthCounter > 0) {
+        if (!enable) {
+            noise.lengthCounter = 0;
+        } else if (!noise.Register0Flag.lengthCounterHalt) {
+            noise.lengthCounter--;
+        }
+    }
+}
+
 void Apu::doLinearCounters(Triangle& triangle)
 {
     if (triangle.linearCounterReload) {
@@ -365,3 +706,152 @@ void Apu::doLinearCounters(Triangle& triangle)
         triangle.linearCounterReload = false;
     }
 }
+
+void Apu::writeDmc(uint16_t address, uint8_t data)
+{
+    // Reference: https://wiki.nesdev.com/w/index.php/APU_DMC
+    switch (address) {
+    case DMCAddress0:
+        _dmc.register0 = data;
+        // Timer runs on APU cycles, the table is in CPU cycles
+        _dmc.period = dmcRateTable[_dmc.Register0Flag.rateIndex] / 2 - 1;
+        if (!_dmc.Register0Flag.interruptEnable) {
+            _dmc.interruptFlag = false;
+        }
+        break;
+    case DMCAddress1:
+        _dmc.outputLevel = data & 0x7F;
+        break;
+    case DMCAddress2:
+        _dmc.sampleAddress = data;
+        break;
+    case DMCAddress3:
+        _dmc.sampleLength = data;
+        break;
+    case apuControlAddress:
+        _dmc.interruptFlag = false;
+        if (!(data & 0x10)) {
+            _dmc.bytesRemaining = 0;
+        } else if (_dmc.bytesRemaining == 0) {
+            restartDmc();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void Apu::clockDmc()
+{
+    // Memory reader fills the sample buffer as soon as it empties
+    if (_dmc.sampleBufferEmpty && (_dmc.bytesRemaining > 0)) {
+        readDmcSample();
+    }
+
+    if (_dmc.timer > 0) {
+        _dmc.timer--;
+        return;
+    }
+    _dmc.timer = _dmc.period;
+
+    // Output unit moves the level by 2 for every bit, within 0-127
+    if (!_dmc.silence) {
+        auto level = _dmc.outputLevel;
+        if (_dmc.shiftRegister & 0x01) {
+            if (level <= 125) {
+                level += 2;
+            }
+        } else if (level >= 2) {
+            level -= 2;
+        }
+        if (level != _dmc.outputLevel) {
+            _dmc.outputLevel = level;
+            setDmcOutput(level);
+        }
+    }
+    _dmc.shiftRegister >>= 1;
+
+    _dmc.bitsRemaining--;
+    if (_dmc.bitsRemaining == 0) {
+        _dmc.bitsRemaining = 8;
+        _dmc.silence = _dmc.sampleBufferEmpty;
+        if (!_dmc.sampleBufferEmpty) {
+            _dmc.shiftRegister = _dmc.sampleBuffer;
+            _dmc.sampleBufferEmpty = true;
+        }
+    }
+}
+
+void Apu::readDmcSample()
+{
+    _dmc.sampleBuffer = _dmcRead ? _dmcRead(_dmc.currentAddress) : 0x00;
+    _dmc.sampleBufferEmpty = false;
+
+    // Address wraps around to the start of the cartridge
+    _dmc.currentAddress = (_dmc.currentAddress == 0xFFFF) ? 0x8000 : _dmc.currentAddress + 1;
+    _dmc.bytesRemaining--;
+    if (_dmc.bytesRemaining == 0) {
+        if (_dmc.Register0Flag.loopFlag) {
+            restartDmc();
+        } else if (_dmc.Register0Flag.interruptEnable) {
+            _dmc.interruptFlag = true;
+        }
+    }
+}
+
+void Apu::restartDmc()
+{
+    _dmc.currentAddress = 0xC000 + static_cast<uint16_t>(_dmc.sampleAddress) * 64;
+    _dmc.bytesRemaining = static_cast<uint16_t>(_dmc.sampleLength) * 16 + 1;
+}
+
+void Apu::setDmcOutput(uint8_t level)
+{
+    // Same as a $4011 write, for the channels wherever they run
+    if (_syncMode == ApuSyncMode::Deferred) {
+        _lastRegisters[DMCAddress1 - pulse1Address0] = level;
+        if (_isSampleOutputEnabled) {
+            logEvent(DMCAddress1, level);
+        }
+    } else {
+        _dmcOutput = level;
+        _isOutputChanged = true;
+    }
+}
+
+void Apu::writeStatus(uint16_t address, uint8_t data)
+{
+    // Reference: https://wiki.nesdev.com/w/index.php/APU_Length_Counter
+    auto enable = _lastRegisters[apuControlAddress - pulse1Address0];
+    for (uint32_t channel = 0; channel < 4; channel++) {
+        if ((address == pulse1Address0 + statusLengthRegisters[channel]) && (enable & (1 << channel))) {
+            _statusLengthCounters[channel] = lengthCounterTable[data >> 3];
+        }
+        if ((address == apuControlAddress) && !(data & (1 << channel))) {
+            _statusLengthCounters[channel] = 0;
+        }
+    }
+
+    if ((address >= pulse1Address0) && (address <= apuControlAddress)) {
+        _lastRegisters[address - pulse1Address0] = data;
+    }
+}
+
+void Apu::clockStatus()
+{
+    // Half frames of the 4-step sequence, the same as runCycle()
+    _statusFrameCounter++;
+    if ((_statusFrameCounter != 7457) && (_statusFrameCounter != 14916)) {
+        return;
+    }
+    if (_statusFrameCounter == 14916) {
+        _statusFrameCounter = 0;
+    }
+
+    for (uint32_t channel = 0; channel < 4; channel++) {
+        auto isHalted = _lastRegisters[statusHaltRegisters[channel]] & statusHaltMasks[channel];
+        if ((_statusLengthCounters[channel] > 0) && !isHalted) {
+            _statusLengthCounters[channel]--;
+        }
+    }
+}
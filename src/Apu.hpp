@@ -3,10 +3,58 @@
 #include <cstdint>
 #include <array>
 #include <atomic>
-#include <mutex>
+#include <functional>
 #include <stdio.h>
 
 #include "IDevice.hpp"
+#include "RingBuffer.hpp"
+#include "BlipBuffer.hpp"
+
+// Samples buffered between the emulation and the audio output, about 370 ms
+// at 44.1 kHz
+#define APU_SAMPLE_BUFFER_SIZE 16384
+
+// Most the sample rate gets nudged by to keep the buffer at its target fill
+#define APU_MAX_RATE_CORRECTION 0.005
+
+// Events logged for the audio thread in deferred mode, the register writes
+// of many frames
+#define APU_EVENT_LOG_SIZE 16384
+
+// Where the APU channels run
+enum class ApuSyncMode {
+    // In tick() and write(), on the emulation thread
+    Immediate,
+    // tick() and write() only log register writes with the cycle they happen
+    // at. Whoever reads the samples replays the log and runs the channels,
+    // which moves audio synthesis over to the audio thread. The length
+    // counters that $4015 reads report are also kept with the emulation.
+    Deferred,
+};
+
+// Register write logged in deferred mode, address 0 only tells time
+struct ApuEvent {
+    uint32_t cycle;
+    uint16_t address;
+    uint8_t data;
+};
+
+struct ApuStats {
+    // Samples produced but not read yet, now and at least/most since reset
+    uint32_t bufferedSamples;
+    uint32_t minBufferedSamples;
+    uint32_t maxBufferedSamples;
+    // Fill the rate control aims for
+    uint32_t targetSamples;
+    // Sample rate correction applied now, e.g. 0.001 for 0.1% more samples
+    double rateCorrection;
+    // Reads that came up short, and samples dropped because nobody read them
+    uint64_t underruns;
+    uint64_t droppedSamples;
+    // Register writes the deferred log had no room for, each time the log
+    // overflows the replay is rebuilt from the last register values
+    uint64_t droppedEvents;
+};
 
 struct PulseRegister0Flags {
     uint8_t envelopePeriod : 4;
@@ -53,7 +101,8 @@ struct Pulse {
     // Data
     uint8_t volume{0x00};
     uint16_t period{0x0000};
-    float dutyCycle{0.0f};
+    uint16_t timer{0x0000};
+    uint8_t sequenceStep{0x00};
     uint8_t envelopeDecay{0x00};
     uint8_t envelopeCounter{0x00};
     bool envelopeStart{false};
@@ -94,11 +143,89 @@ struct Triangle {
 
     // Data
     uint16_t period{0x0000};
+    uint16_t timer{0x0000};
+    uint8_t sequenceStep{0x00};
     uint8_t lengthCounter{0x00};
     bool linearCounterReload{false};
     uint8_t linearCounter{0x00};
 };
 
+struct NoiseRegister0Flags {
+    uint8_t envelopePeriod : 4;
+    bool constantEnvelopeFlag : 1;
+    bool lengthCounterHalt : 1;
+    uint8_t unused : 2;
+};
+
+struct NoiseRegister1Flags {
+    uint8_t periodIndex : 4;
+    uint8_t unused : 3;
+    bool modeFlag : 1;
+};
+
+struct NoiseRegister2Flags {
+    uint8_t unused : 3;
+    uint8_t lengthCounter : 5;
+};
+
+struct Noise {
+    // Registers
+    union {
+        uint8_t register0;
+        NoiseRegister0Flags Register0Flag;
+    };
+    union {
+        uint8_t register1;
+        NoiseRegister1Flags Register1Flag;
+    };
+    union {
+        uint8_t register2;
+        NoiseRegister2Flags Register2Flag;
+    };
+
+    // Data
+    uint8_t volume{0x00};
+    uint16_t period{0x0000};
+    uint16_t timer{0x0000};
+    uint16_t shiftRegister{0x0001};
+    uint8_t envelopeDecay{0x00};
+    uint8_t envelopeCounter{0x00};
+    bool envelopeStart{false};
+    uint8_t lengthCounter{0x00};
+};
+
+struct DMCRegister0Flags {
+    uint8_t rateIndex : 4;
+    uint8_t unused : 2;
+    bool loopFlag : 1;
+    bool interruptEnable : 1;
+};
+
+struct DMC {
+    // Registers
+    union {
+        uint8_t register0;
+        DMCRegister0Flags Register0Flag;
+    };
+    uint8_t sampleAddress{0x00};
+    uint8_t sampleLength{0x00};
+
+    // Output unit
+    uint16_t period{0x0000};
+    uint16_t timer{0x0000};
+    uint8_t outputLevel{0x00};
+    uint8_t shiftRegister{0x00};
+    uint8_t bitsRemaining{8};
+    bool silence{true};
+
+    // Memory reader
+    uint8_t sampleBuffer{0x00};
+    bool sampleBufferEmpty{true};
+    uint16_t currentAddress{0x0000};
+    uint16_t bytesRemaining{0x0000};
+    bool interruptFlag{false};
+};
+
 struct ControlRegisterFlags {
     bool pulse1Enable : 1;
     bool pulse2Enable : 1;
@@ -130,24 +257,76 @@ public:
     void tick();
     void reset();
 
-    float getMixedOutput(float time);
+    /// Rate tick() produces output samples at
+    void setSampleRate(uint32_t sampleRate);
+
+    /// Reads DMC sample bytes through the CPU bus, and stalls the CPU for
+    /// the time it takes
+    void setDmcReadCallback(std::function<uint8_t(uint16_t address)> callback) { _dmcRead = std::move(callback); }
+
+    /// The DMC asks for an IRQ until it is acknowledged
+    bool isInterruptRequested() const { return _dmc.interruptFlag; }
+
+    /// Turn off producing samples, e.g. when audio is discarded anyway. The
+    /// channels keep running, unless deferred.
+    void setSampleOutput(bool enable) { _isSampleOutputEnabled = enable; }
+
+    /// Set before samples are read for the first time
+    void setSyncMode(ApuSyncMode mode) { _syncMode = mode; }
+    ApuSyncMode getSyncMode() const { return _syncMode; }
+
+    /// Number of buffered samples to aim for. The sample rate is nudged by
+    /// up to APU_MAX_RATE_CORRECTION to stay there, so the audio output
+    /// neither runs dry nor drifts behind when its clock and the frame rate
+    /// do not quite agree. 0 turns the rate control off.
+    void setTargetSamples(uint32_t samples) { _targetSamples = samples; }
+
+    /// Take out samples produced by tick(), from the audio thread
+    /// @return number of samples read, fewer than count when running short
+    uint32_t readSamples(float* samples, uint32_t count);
+
+    /// Number of samples produced but not read yet
+    uint32_t getBufferedSamples() const { return _samples.getSize(); }
+
+    ApuStats getStats() const;
+    void resetStats();
 
 private:
-    using LockGuard = std::unique_lock<std::mutex>;
-    std::mutex _mutex;
+    void runCycle();
+    void writeRegister(uint16_t address, uint8_t data);
+    void logEvent(uint16_t address, uint8_t data);
+    void logRegisterState();
+    void replayEvents();
+    void writeStatus(uint16_t address, uint8_t data);
+    void clockStatus();
+
+    void writeDmc(uint16_t address, uint8_t data);
+    void clockDmc();
+    void readDmcSample();
+    void restartDmc();
+    void setDmcOutput(uint8_t level);
 
     void doQuarterFrame();
     void doHalfFrame();
 
     void doEnvelope(Pulse& pulse);
+    void doEnvelope(Noise& noise);
     void doSweep(Pulse& pulse);
     void doLengthCounters(Pulse& pulse, bool enable);
     void doLengthCounters(Triangle& triangle, bool enable);
+    void doLengthCounters(Noise& noise, bool enable);
     void doLinearCounters(Triangle& triangle);
 
-    float getPulseOutput(Pulse pulse, float time);
-    float getTriangleOutput(Triangle triangle, float time);
-    float getDutyCycle(uint8_t dutyCycle);
+    bool clockTimer(Pulse& pulse);
+    bool clockTimer(Triangle& triangle);
+    bool clockTimer(Noise& noise);
+    uint8_t getPulseOutput(const Pulse& pulse);
+    uint8_t getTriangleOutput(const Triangle& triangle);
+    uint8_t getNoiseOutput(const Noise& noise);
+    float getMixedOutput();
+    void updateOutput(uint32_t time);
+    void outputSamples();
+    void updateRateCorrection();
 
     uint32_t _frameCounter{0};
 
@@ -160,4 +339,60 @@ private:
 
     // Triangle data
     Triangle _triangle;
+
+    // Noise data
+    Noise _noise;
+
+    // DMC data. The DMC reads memory and stalls the CPU, so it always runs
+    // with the emulation, and hands its level over to the channels in
+    // _dmcOutput the way a $4011 write does.
+    DMC _dmc;
+    uint8_t _dmcOutput{0x00};
+    std::function<uint8_t(uint16_t address)> _dmcRead{nullptr};
+
+    // Nonlinear mixer: output of both pulses by their summed level, and of
+    // triangle, noise and DMC by 3 * triangle + 2 * noise + DMC
+    float _pulseTable[31];
+    float _tndTable[203];
+
+    // Output is synthesized from its amplitude steps, timed in CPU cycles
+    // since the start of the current blip frame
+    BlipBuffer _blip;
+    uint32_t _blipClock{0};
+    float _output{0.0f};
+    bool _isOutputChanged{false};
+    float _frameSamples[128];
+    RingBuffer<float> _samples{APU_SAMPLE_BUFFER_SIZE};
+
+    // Deferred mode: the emulation logs events at _logCycle, the reader runs
+    // the channels from _replayCycle up to them. What tick() touches is kept
+    // off the cache lines of the reader.
+    alignas(64) ApuSyncMode _syncMode{ApuSyncMode::Immediate};
+    bool _isSampleOutputEnabled{true};
+    uint32_t _logCycle{0};
+
+    // Deferred mode, emulation side: length counters for $4015 reads, run
+    // by a frame counter of their own, and the last value written to every
+    // register, to rebuild the replay state from when the log overflowed
+    uint32_t _statusFrameCounter{0};
+    uint8_t _statusLengthCounters[4]{};
+    uint8_t _lastRegisters[0x18]{};
+    bool _isReplayStale{false};
+
+    alignas(64) uint32_t _replayCycle{0};
+    RingBuffer<ApuEvent> _events{APU_EVENT_LOG_SIZE};
+    ApuEvent _replayedEvents[256];
+
+    // Rate control, the fill is averaged as reads take out whole blocks
+    std::atomic<uint32_t> _targetSamples{2048};
+    float _averageFill{0.0f};
+
+    // Statistics, written by the emulation and audio threads and read from
+    // anywhere
+    std::atomic<uint32_t> _minBufferedSamples{UINT32_MAX};
+    std::atomic<uint32_t> _maxBufferedSamples{0};
+    std::atomic<double> _rateCorrection{0.0};
+    std::atomic<uint64_t> _underruns{0};
+    std::atomic<uint64_t> _droppedSamples{0};
+    std::atomic<uint64_t> _droppedEvents{0};
 };
@@ -1,7 +1,5 @@
 #include "AudioHw.hpp"
 
-constexpr auto sampleMaxResolution = 32760.0f;
-
 AudioHw::AudioHw(unsigned int sampleRate,
         unsigned int numBlocks,
         unsigned int numSamples)
@@ -12,6 +10,9 @@ AudioHw::AudioHw(unsigned int sampleRate,
     // Open Audio device
     const char* name = alcGetString(NULL, ALC_DEFAULT_DEVICE_SPECIFIER);
     _device = alcOpenDevice(name);
+    if (_device == NULL) {
+        return;
+    }
     _context = alcCreateContext(_device, NULL);
     alcMakeContextCurrent(_context);
 
@@ -27,18 +28,29 @@ AudioHw::AudioHw(unsigned int sampleRate,
     // Allocate Memory
     _sampleMemory = new short[_numSamples];
     std::fill(_sampleMemory, _sampleMemory + _numSamples, 0);
+    _samples.resize(_numSamples, 0.0f);
 
-    _isRunning = true;
-    _audioThread = std::make_unique<std::thread>([this] { audioThread(); });
+    _blockPeriod = std::chrono::microseconds{1000000ull * _numSamples / _sampleRate};
 }
 
 AudioHw::~AudioHw()
 {
-    _isRunning = false;
-    _audioThread->join();
+    if (_audioThread) {
+        {
+            std::lock_guard<std::mutex> lock(_stopMutex);
+            _isRunning = false;
+        }
+        _stopRequested.notify_all();
+        _audioThread->join();
+    }
+
+    if (_device == NULL) {
+        return;
+    }
 
     alDeleteBuffers(_numBlocks, _buffers);
     delete[] _buffers;
+    delete[] _sampleMemory;
     alDeleteSources(1, &_source);
 
     alcMakeContextCurrent(NULL);
@@ -46,16 +58,30 @@ AudioHw::~AudioHw()
     alcCloseDevice(_device);
 }
 
-void AudioHw::setReadSampleCallback(std::function<float(float)> callback)
+void AudioHw::setReadSamplesCallback(std::function<uint32_t(float*, uint32_t)> callback)
 {
-    _readSample = callback;
+    _readSamples = callback;
+}
+
+bool AudioHw::start()
+{
+    if (_device == NULL) {
+        fprintf(stderr, "Failed to open audio device\n");
+        return false;
+    }
+    if (_audioThread) {
+        return true;
+    }
+
+    _isRunning = true;
+    _audioThread = std::make_unique<std::thread>([this] { audioThread(); });
+    return true;
 }
 
 void AudioHw::audioThread()
 {
-    auto currentTime = 0.0f;
-    auto timeStep = 1.0f / static_cast<float>(_sampleRate);
     std::vector<ALuint> processedBuffers;
+    auto lastSample = 0.0f;
 
     while (_isRunning)
     {
@@ -70,24 +96,26 @@ void AudioHw::audioThread()
             _availableBuffers.push(buffer);
         }
 
-        // Make sure we have available buffers
+        // Nothing to do until the device is done with a block. Waking up
+        // halfway through one leaves the slack of a half block.
         if (_availableBuffers.empty()) {
+            std::unique_lock<std::mutex> lock(_stopMutex);
+            _stopRequested.wait_for(lock, _blockPeriod / 2, [this] { return !_isRunning; });
             continue;
         }
 
-        // Read Audio samples
-        auto sample = short{0};
-        for (auto index = 0u; index < _numSamples; index++)
-        {
-            auto sampleFloat = _readSample(currentTime);
-            if (sampleFloat >= 0.0) {
-                sample = static_cast<short>(fmin(sampleFloat, 1.0) * sampleMaxResolution);
-            } else {
-                sample = static_cast<short>(fmax(sampleFloat, -1.0) * sampleMaxResolution);
-            }
-            _sampleMemory[index] = sample;
-
-            currentTime += timeStep;
+        // Read Audio samples, running short repeats the last one to not click
+        auto numRead = _readSamples ? _readSamples(_samples.data(), _numSamples) : 0;
+        if (numRead > 0) {
+            lastSample = _samples[numRead - 1];
+        }
+        for (auto index = numRead; index < _numSamples; index++) {
+            _samples[index] = lastSample;
+        }
+
+        for (auto index = 0u; index < _numSamples; index++) {
+            // Samples are still read while muted, so none are stale on unmute
+            _sampleMemory[index] = _isMuted ? 0 : toPcm16(_samples[index]);
         }
 
         // Upload buffer to OpenAL
@@ -1,22 +1,46 @@
 #pragma once
 
 #include <queue>
+#include <vector>
 #include <atomic>
 #include <functional>
 #include <thread>
-#include <cmath>
+#include <mutex>
+#include <chrono>
+#include <condition_variable>
+#include <stdio.h>
 
 #include <AL/al.h>
 #include <AL/alc.h>
 
-class AudioHw {
+#include "IAudioSink.hpp"
+
+// Plays samples through OpenAL. numBlocks blocks of numSamples samples each
+// are queued to the device, the audio thread refills them as they are played
+// and sleeps in between, so the latency is about numBlocks * numSamples
+// samples.
+class AudioHw : public IAudioSink {
 public:
     AudioHw(uint32_t sampleRate,
             uint32_t numBlocks,
             uint32_t numSamples);
     ~AudioHw();
 
-    void setReadSampleCallback(std::function<float(float)> func);
+    /// @name Implementation IAudioSink
+    /// @[
+    uint32_t getSampleRate() const { return _sampleRate; }
+    uint32_t getBlockSize() const { return _numSamples; }
+    bool isRealTime() const { return true; }
+
+    /// Called for every block of samples to play, running short repeats the
+    /// last sample
+    void setReadSamplesCallback(std::function<uint32_t(float*, uint32_t)> func);
+
+    /// Start the audio thread
+    bool start();
+
+    void setMuted(bool muted) { _isMuted = muted; }
+    /// @]
 
 private:
     void audioThread();
@@ -25,14 +49,22 @@ private:
     uint32_t _numBlocks{0};
     uint32_t _numSamples{0};
 
-    ALCdevice* _device;
-    ALCcontext* _context;
-    ALuint*_buffers;
+    ALCdevice* _device{nullptr};
+    ALCcontext* _context{nullptr};
+    ALuint*_buffers{nullptr};
     ALuint _source;
     std::queue<ALuint> _availableBuffers;
 
-    short* _sampleMemory;
-    std::atomic<bool> _isRunning;
+    std::vector<float> _samples;
+    short* _sampleMemory{nullptr};
+    std::atomic<bool> _isRunning{false};
+    std::atomic<bool> _isMuted{false};
     std::unique_ptr<std::thread> _audioThread;
-    std::function<float(float)> _readSample{nullptr};
+
+    // Time it takes to play one block, the thread sleeps on _stopRequested
+    // while no block is free
+    std::chrono::microseconds _blockPeriod{0};
+    std::mutex _stopMutex;
+    std::condition_variable _stopRequested;
+    std::function<uint32_t(float*, uint32_t)> _readSamples{nullptr};
 };
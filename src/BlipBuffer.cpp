@@ -0,0 +1,117 @@
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+#include "BlipBuffer.hpp"
+
+// Kernel cutoff relative to the Nyquist frequency, a little below it leaves
+// room for the transition band
+constexpr double kernelCutoff = 0.92;
+
+// DC blocking filter corner frequency
+constexpr double highPassFrequency = 10.0;
+
+BlipBuffer::BlipBuffer(uint32_t clockRate, uint32_t sampleRate, uint32_t maxFrameClocks)
+: _maxFrameClocks{maxFrameClocks}
+{
+    // Windowed sinc impulse for every fractional position, with a delay of
+    // half the kernel so that it never reaches back before the position
+    for (uint32_t phase = 0; phase < BLIP_PHASES; phase++) {
+        auto sum = 0.0;
+        double values[BLIP_TAPS];
+        for (uint32_t tap = 0; tap < BLIP_TAPS; tap++) {
+            auto x = static_cast<double>(tap) - (BLIP_TAPS / 2 - 1) - static_cast<double>(phase) / BLIP_PHASES;
+            auto sinc = (x == 0.0) ? 1.0 : sin(M_PI * kernelCutoff * x) / (M_PI * kernelCutoff * x);
+            auto window = (x + BLIP_TAPS / 2) / BLIP_TAPS;
+            auto blackman = 0.42 - 0.5 * cos(2.0 * M_PI * window) + 0.08 * cos(4.0 * M_PI * window);
+            values[tap] = sinc * blackman;
+            sum += values[tap];
+        }
+
+        // Each impulse adds up to exactly one step
+        for (uint32_t tap = 0; tap < BLIP_TAPS; tap++) {
+            _kernel[phase][tap] = static_cast<float>(values[tap] / sum);
+        }
+    }
+
+    setRates(clockRate, sampleRate);
+}
+
+void BlipBuffer::setRates(uint32_t clockRate, uint32_t sampleRate)
+{
+    _sampleRate = sampleRate;
+    _baseFactor = ldexp(static_cast<double>(sampleRate) / clockRate, fractionBits);
+    _factor = static_cast<uint64_t>(_baseFactor);
+
+    // Room for the samples of two frames, one not read yet and one in
+    // progress, plus the tail of the last impulse. The rate correction never
+    // comes close to needing more.
+    auto maxSamples = static_cast<uint32_t>((_maxFrameClocks * _factor) >> fractionBits) + 1;
+    _buffer.resize(2 * maxSamples + BLIP_TAPS);
+    clear();
+}
+
+void BlipBuffer::setRateCorrection(double correction)
+{
+    _factor = static_cast<uint64_t>(_baseFactor * (1.0 + correction));
+}
+
+void BlipBuffer::addDelta(uint32_t time, float delta)
+{
+    auto position = _offset + time * _factor;
+    auto index = static_cast<uint32_t>(position >> fractionBits);
+    auto phase = static_cast<uint32_t>(position >> (fractionBits - BLIP_PHASE_BITS)) & (BLIP_PHASES - 1);
+
+    auto buffer = &_buffer[index];
+    const auto kernel = _kernel[phase];
+#if defined(__SSE__)
+    // Four taps at a time, the kernel rows are 16-byte aligned
+    auto scale = _mm_set1_ps(delta);
+    for (uint32_t tap = 0; tap < BLIP_TAPS; tap += 4) {
+        auto taps = _mm_mul_ps(scale, _mm_load_ps(kernel + tap));
+        _mm_storeu_ps(buffer + tap, _mm_add_ps(_mm_loadu_ps(buffer + tap), taps));
+    }
+#else
+    for (uint32_t tap = 0; tap < BLIP_TAPS; tap++) {
+        buffer[tap] += delta * kernel[tap];
+    }
+#endif
+}
+
+void BlipBuffer::endFrame(uint32_t clocks)
+{
+    _offset += clocks * _factor;
+}
+
+uint32_t BlipBuffer::readSamples(float* samples, uint32_t count)
+{
+    count = std::min(count, getSamplesAvailable());
+
+    // A one pole high-pass takes out the DC offset the integration carries
+    auto highPassFactor = static_cast<float>(exp(-2.0 * M_PI * highPassFrequency / _sampleRate));
+    for (uint32_t index = 0; index < count; index++) {
+        _integrator += _buffer[index];
+        _highPass = _highPass * highPassFactor + _integrator * (1.0f - highPassFactor);
+        samples[index] = _integrator - _highPass;
+    }
+
+    // Move what is left to the front, impulses of the frame in progress
+    // included
+    auto remaining = static_cast<uint32_t>(_buffer.size()) - count;
+    memmove(_buffer.data(), _buffer.data() + count, remaining * sizeof(float));
+    std::fill(_buffer.begin() + remaining, _buffer.end(), 0.0f);
+    _offset -= static_cast<uint64_t>(count) << fractionBits;
+
+    return count;
+}
+
+void BlipBuffer::clear()
+{
+    _offset = 0;
+    _integrator = 0.0f;
+    _highPass = 0.0f;
+    std::fill(_buffer.begin(), _buffer.end(), 0.0f);
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Positions a step can take between two output samples, and kernel width
+#define BLIP_PHASE_BITS 6
+#define BLIP_PHASES (1 << BLIP_PHASE_BITS)
+#define BLIP_TAPS 16
+
+// Band-limited synthesis buffer, in the style of blip_buf.
+//
+// Instead of sampling waveforms, sound sources tell the buffer whenever their
+// amplitude steps, with the exact clock the step happened at. Each step is
+// added as a band-limited impulse, a windowed sinc picked from a precomputed
+// table by the fractional sample position, and reading integrates the impulses
+// back into steps. The cost is per amplitude step rather than per clock, and
+// the output has no aliasing at any sample rate.
+//
+// Time is counted in clocks of the sound source, from the start of the
+// current frame. A frame can be any length up to maxFrameClocks, and its
+// samples should be read before the next one ends.
+class BlipBuffer {
+public:
+    BlipBuffer(uint32_t clockRate, uint32_t sampleRate, uint32_t maxFrameClocks);
+
+    void setRates(uint32_t clockRate, uint32_t sampleRate);
+
+    /// Produce slightly more or fewer samples than the sample rate, e.g.
+    /// 0.001 for 0.1% more. Only call it between frames.
+    void setRateCorrection(double correction);
+
+    /// Amplitude changed by delta at a given clock of the current frame
+    void addDelta(uint32_t time, float delta);
+
+    /// End the current frame after a number of clocks, the samples it
+    /// completed become available for reading
+    void endFrame(uint32_t clocks);
+
+    uint32_t getSamplesAvailable() const { return static_cast<uint32_t>(_offset >> fractionBits); }
+
+    /// Take out completed samples
+    /// @return number of samples read
+    uint32_t readSamples(float* samples, uint32_t count);
+
+    void clear();
+
+private:
+    static constexpr uint32_t fractionBits = 32;
+
+    // Sample position of a clock, as fixed point with fractionBits
+    uint64_t _factor{0};
+    double _baseFactor{0.0};
+    uint64_t _offset{0};
+
+    uint32_t _maxFrameClocks{0};
+    uint32_t _sampleRate{0};
+
+    // Band-limited impulse for every phase
+    alignas(16) float _kernel[BLIP_PHASES][BLIP_TAPS];
+
+    // Impulses not read yet, and the running sum integrating them
+    std::vector<float> _buffer;
+    float _integrator{0.0f};
+    float _highPass{0.0f};
+};
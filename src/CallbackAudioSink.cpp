@@ -0,0 +1,32 @@
+#include "CallbackAudioSink.hpp"
+
+CallbackAudioSink::CallbackAudioSink(uint32_t sampleRate, uint32_t blockSize)
+: _sampleRate{sampleRate}
+, _blockSize{blockSize}
+{
+}
+
+bool CallbackAudioSink::start()
+{
+    _isStarted = true;
+    return true;
+}
+
+void CallbackAudioSink::read(float* samples, uint32_t count)
+{
+    // The application may ask before the emulation is wired up
+    auto numRead = (_isStarted && _readSamples) ? _readSamples(samples, count) : 0;
+    if (numRead > 0) {
+        _lastSample = samples[numRead - 1];
+    }
+    for (auto index = numRead; index < count; index++) {
+        samples[index] = _lastSample;
+    }
+
+    // Samples are still read while muted, so none are stale on unmute
+    if (_isMuted) {
+        for (uint32_t index = 0; index < count; index++) {
+            samples[index] = 0.0f;
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+
+#include "IAudioSink.hpp"
+
+// For embedding the emulator in an application that has an audio output of
+// its own: the application pulls samples with read(), typically from the
+// callback of its audio API.
+class CallbackAudioSink : public IAudioSink {
+public:
+    /// @param blockSize - samples the application usually asks for at once
+    CallbackAudioSink(uint32_t sampleRate, uint32_t blockSize);
+
+    /// Fill a whole buffer with samples. Running short repeats the last
+    /// sample, to not click.
+    void read(float* samples, uint32_t count);
+
+    /// @name Implementation IAudioSink
+    /// @[
+    uint32_t getSampleRate() const { return _sampleRate; }
+    uint32_t getBlockSize() const { return _blockSize; }
+    bool isRealTime() const { return true; }
+    void setReadSamplesCallback(std::function<uint32_t(float*, uint32_t)> callback) { _readSamples = callback; }
+    bool start();
+    void setMuted(bool muted) { _isMuted = muted; }
+    /// @]
+
+private:
+    uint32_t _sampleRate{0};
+    uint32_t _blockSize{0};
+
+    float _lastSample{0.0f};
+    std::atomic<bool> _isStarted{false};
+    std::atomic<bool> _isMuted{false};
+    std::function<uint32_t(float*, uint32_t)> _readSamples{nullptr};
+};
@@ -1,3 +1,6 @@
+#include <stdio.h>
+#include <string.h>
+
 #include "Cartridge.hpp"
 #include "Mapper000.hpp"
 #include "Mapper002.hpp"
@@ -8,23 +11,32 @@ constexpr auto size16KB = 16 * 1024;
 Cartridge::Cartridge(std::string fileName)
 : _fileName{std::move(fileName)}
 {
-    auto file = std::ifstream{_fileName, std::ifstream::binary};
-    if (file) {
-        file.read((char*)&_nesHeader, sizeof(NesHeader));
+    _romImage = RomImage::load(_fileName);
+    if (_romImage) {
+        auto romData = _romImage->getData();
+        auto romSize = _romImage->getSize();
+        if (romSize < sizeof(NesHeader)) {
+            fprintf(stderr, "NES ROM %s is too small\n", _fileName.c_str());
+            return;
+        }
+        memcpy(&_nesHeader, romData, sizeof(NesHeader));
+        auto romOffset = static_cast<size_t>(sizeof(NesHeader));
 
         // Check if trainer is available
         if (_nesHeader.bitFlags6.trainerAvailable) {
             // Read past 512-byte
-            file.seekg(512, std::ios_base::cur);
+            romOffset += 512;
         }
 
         _mapperID = (_nesHeader.bitFlags7.mapperHighNibble << 4) | _nesHeader.bitFlags6.mapperLowNibble;
         _mirroringMode = static_cast<MirroringMode>(_nesHeader.bitFlags6.mirroringMode);
+        if (_nesHeader.bitFlags6.vRamExpansion) {
+            // Cartridge provides its own VRAM for all four nametables
+            _mirroringMode = MirroringMode::FourScreen;
+        }
 
         // Assume fileFormatType=1 for now
         _prgRomSize = _nesHeader.prgRomChunks * size16KB;
-        _prgRom.resize(_prgRomSize);
-        file.read(reinterpret_cast<char*>(_prgRom.data()), _prgRomSize);
 
         if (_nesHeader.chrRomChunks == 0) {
             // Used for RAM
@@ -33,8 +45,22 @@ Cartridge::Cartridge(std::string fileName)
             // Used for ROM
             _chrRomSize = _nesHeader.chrRomChunks * size8KB;
         }
-        _chrRom.resize(_chrRomSize);
-        file.read(reinterpret_cast<char*>(_chrRom.data()), _chrRomSize);
+
+        auto romEnd = romOffset + _prgRomSize + ((_nesHeader.chrRomChunks == 0) ? 0 : _chrRomSize);
+        if (romSize < romEnd) {
+            // Truncated file, what is missing reads as zeros from a copy of our own
+            _romCopy.assign(romEnd, 0x00);
+            memcpy(_romCopy.data(), romData, romSize);
+            romData = _romCopy.data();
+        }
+
+        _prgRom = romData + romOffset;
+        if (_nesHeader.chrRomChunks == 0) {
+            _chrRam.resize(_chrRomSize);
+            _chrRom = _chrRam.data();
+        } else {
+            _chrRom = romData + romOffset + _prgRomSize;
+        }
 
         // Switch to correct Mapper
         switch (_mapperID) {
@@ -46,7 +72,7 @@ Cartridge::Cartridge(std::string fileName)
             break;
         default:
             fprintf(stderr, "NES ROM Mapper [%d] not yet supported\n", _mapperID);
-            break;
+            return;
         }
 
         _isValid = true;
@@ -68,11 +94,9 @@ bool Cartridge::readPRG(uint16_t address, uint8_t& data)
 
 bool Cartridge::writePRG(uint16_t address, uint8_t data)
 {
+    // PRG ROM is read-only, writes only reach the mapper registers
     auto prgAddress = uint32_t{0};
-    if (_mapper->writePrg(address, prgAddress, data)) {
-        _prgRom[prgAddress] = data;
-        return true;
-    }
+    _mapper->writePrg(address, prgAddress, data);
 
     return false;
 }
@@ -92,13 +116,31 @@ bool Cartridge::writeCHR(uint16_t address, uint8_t data)
 {
     auto chrAddress = uint32_t{0};
     if (_mapper->writeChr(address, chrAddress)) {
-        _chrRom[chrAddress] = data;
+        // Mappers only allow writes when there is CHR RAM
+        _chrRam[chrAddress] = data;
         return true;
     }
 
     return false;
 }
 
+void Cartridge::setMirroringMode(MirroringMode mirroringMode)
+{
+    if (mirroringMode == _mirroringMode) {
+        return;
+    }
+
+    _mirroringMode = mirroringMode;
+    if (_mirroringChanged) {
+        _mirroringChanged(_mirroringMode);
+    }
+}
+
+void Cartridge::setMirroringCallback(std::function<void(MirroringMode)> callback)
+{
+    _mirroringChanged = callback;
+}
+
 void Cartridge::reset()
 {
     if (_mapper != nullptr) {
@@ -3,10 +3,11 @@
 #include <memory>
 #include <cstdint>
 #include <string>
-#include <fstream>
 #include <vector>
+#include <functional>
 
 #include "IMapper.hpp"
+#include "RomImage.hpp"
 
 /*
  * The .NES file format is the de facto standard for distribution of NES binary
@@ -45,8 +46,9 @@ struct NesHeader {
 enum class MirroringMode {
     Horizontal,
     Vertical,
-    // OneScreenLow,
-    // OneScreenHigh,
+    OneScreenLow,
+    OneScreenHigh,
+    FourScreen,
 };
 
 class Cartridge {
@@ -56,6 +58,8 @@ public:
 
     bool isValid() const { return _isValid; }
     MirroringMode getMirroringMode() const { return _mirroringMode; }
+    void setMirroringMode(MirroringMode mirroringMode);
+    void setMirroringCallback(std::function<void(MirroringMode)> callback);
     bool readPRG(uint16_t address, uint8_t& data);
     bool writePRG(uint16_t address, uint8_t data);
     bool readCHR(uint16_t address, uint8_t& data);
@@ -70,7 +74,16 @@ private:
     uint32_t _chrRomSize{0};
     bool _isValid{false};
     MirroringMode _mirroringMode{MirroringMode::Horizontal};
-    std::vector<uint8_t> _prgRom;
-    std::vector<uint8_t> _chrRom;
+
+    // PRG and CHR ROM point into the read-only image, which may be shared
+    // with other instances. Only CHR RAM is our own, _chrRom points to it
+    // when the cartridge has no CHR ROM. Truncated files are copied and
+    // padded with zeros instead.
+    std::shared_ptr<const RomImage> _romImage;
+    std::vector<uint8_t> _romCopy;
+    const uint8_t* _prgRom{nullptr};
+    const uint8_t* _chrRom{nullptr};
+    std::vector<uint8_t> _chrRam;
     std::shared_ptr<IMapper> _mapper{nullptr};
+    std::function<void(MirroringMode)> _mirroringChanged{nullptr};
 };
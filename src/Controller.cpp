@@ -6,6 +6,10 @@ constexpr auto controller2Address = 0x4017;
 
 Controller::Controller()
 {
+    _buttons[0] = 0x00;
+    _buttons[1] = 0x00;
+    _buttonsCached[0] = 0x00;
+    _buttonsCached[1] = 0x00;
 }
 
 void Controller::setKey(uint8_t id, ControllerButton button, bool state)
@@ -13,10 +17,10 @@ void Controller::setKey(uint8_t id, ControllerButton button, bool state)
     // Only toggle the bit mapped to its corresponding button
     if (state) {
         // Button pressed
-        _buttons[id] |= (1 << static_cast<uint8_t>(button));
+        _buttons[id].fetch_or(1 << static_cast<uint8_t>(button));
     } else {
         // Button released
-        _buttons[id] &= ~(1 << static_cast<uint8_t>(button));
+        _buttons[id].fetch_and(~(1 << static_cast<uint8_t>(button)));
     }
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <atomic>
 
 #include "IDevice.hpp"
 
@@ -28,6 +29,7 @@ public:
     /// @]
 
 private:
-    uint8_t _buttons[2];
+    // Set from the input thread while the emulation reads them
+    std::atomic<uint8_t> _buttons[2];
     uint8_t _buttonsCached[2];
 };
@@ -241,6 +241,12 @@ void Cpu::nonMaskableInterruptRequest()
 // Execute one clock cycle
 void Cpu::tick(bool isOddCycle)
 {
+    if (_stallCycles > 0) {
+        // Bus is taken by the DMC fetching a sample
+        _stallCycles--;
+        return;
+    }
+
     if (_dma.mode) {
         // Suspend CPU cycle when we are in DMA mode
         if (!_dma.startTransfer) {
@@ -271,6 +277,10 @@ void Cpu::tick(bool isOddCycle)
         }
     } else {
         // Normal running CPU cycles
+        if ((_cycles == 0) && _isInterruptLineActive) {
+            // IRQ is taken between instructions, unless interrupts are disabled
+            interruptRequest();
+        }
         if (_cycles == 0) {
             // To enable ASM debugging only
             //_disassemble();
@@ -98,15 +98,26 @@ public:
     void interruptRequest();
     void nonMaskableInterruptRequest();
 
+    // Level of the IRQ line, serviced at the next instruction boundary
+    void setInterruptLine(bool active) { _isInterruptLineActive = active; }
+
     // Execute one clock cycle
     void tick(bool isOddCycle);
 
+    // OAM DMA writes straight into the PPU while this is active
+    bool isDMAActive() const { return _dma.mode; }
+
+    // Halt for some cycles while another device takes the bus
+    void stall(uint8_t cycles) { _stallCycles += cycles; }
+
 private:
     uint16_t _currentAddress = 0x0000;
     uint16_t _relativeAddress = 0x00;
     uint8_t _currentOpCode = 0x00;
     uint8_t _currentData = 0x00;
     uint8_t _cycles = 0;
+    uint8_t _stallCycles = 0;
+    bool _isInterruptLineActive = false;
 
     // Bus device attached to this Cpu
     std::shared_ptr<IDevice> _bus;
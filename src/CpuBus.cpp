@@ -19,7 +19,16 @@ bool CpuBus::read(uint16_t address, uint8_t& data)
     case memoryBaseAddress ... memoryEndAddress:
         return _memory->read(address, data);
     case ppuBaseAddress ... ppuEndAddress:
+        // PPUSTATUS (mirrored every 8 bytes) may be answered without a sync
+        if (((address & 0x0007) == 0x0002) && _ppuStatus && _ppuStatus(data)) {
+            return true;
+        }
+        if (_ppuSync) {
+            _ppuSync();
+        }
         return _ppu->read(address, data);
+    case apuStatusAddress:
+        return _apu->read(address, data);
     case controller1Address ... controller2Address:
         return _controller->read(address, data);
     case cartridgeBaseAddress ... cartridgeEndAddress:
@@ -37,12 +46,19 @@ bool CpuBus::write(uint16_t address, uint8_t data)
     case memoryBaseAddress ... memoryEndAddress:
         return _memory->write(address, data);
     case ppuBaseAddress ... ppuEndAddress:
+        if (_ppuSync) {
+            _ppuSync();
+        }
         return _ppu->write(address, data);
     case apuBaseAddress ... apuEndAddress:
         return _apu->write(address, data);
     case controller1Address ... controller2Address:
         return _controller->write(address, data);
     case cartridgeBaseAddress ... cartridgeEndAddress:
+        // Mapper registers may change what the PPU sees
+        if (_ppuSync) {
+            _ppuSync();
+        }
         return _cartridge->writePRG(address, data);
     default:
         break;
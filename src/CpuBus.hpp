@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 
 #include "IDevice.hpp"
 #include "IMemory.hpp"
@@ -16,6 +17,7 @@ constexpr auto ppuEndAddress = 0x3FFF;
 
 constexpr auto apuBaseAddress = 0x4000;
 constexpr auto apuEndAddress = 0x4015;
+constexpr auto apuStatusAddress = 0x4015;
 
 constexpr auto controller1Address = 0x4016;
 constexpr auto controller2Address = 0x4017;
@@ -37,6 +39,14 @@ public:
     bool write(uint16_t address, uint8_t data);
     /// @]
 
+    /// Called right before the CPU touches anything the PPU can observe
+    /// (PPU registers, cartridge mapper), so a lazily stepped PPU can catch up
+    void setPpuSyncCallback(std::function<void()> callback) { _ppuSync = std::move(callback); }
+
+    /// Gets the first go at PPUSTATUS reads, returns false when the PPU has to
+    /// catch up and serve the read itself
+    void setPpuStatusCallback(std::function<bool(uint8_t& data)> callback) { _ppuStatus = std::move(callback); }
+
 private:
     // Memory device attached to this Cpu Bus
     std::shared_ptr<IMemory> _memory;
@@ -53,4 +63,6 @@ private:
     // Controller attached to this Cpu Bus
     std::shared_ptr<IDevice> _controller;
 
+    std::function<void()> _ppuSync;
+    std::function<bool(uint8_t& data)> _ppuStatus;
 };
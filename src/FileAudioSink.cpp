@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <ctype.h>
+#include <string.h>
+
+#include "FileAudioSink.hpp"
+
+constexpr uint32_t wavHeaderSize = 44;
+
+// Little-endian fields of the WAV header
+static void putUint16(uint8_t* data, uint16_t value)
+{
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+}
+
+static void putUint32(uint8_t* data, uint32_t value)
+{
+    putUint16(data, value & 0xFFFF);
+    putUint16(data + 2, (value >> 16) & 0xFFFF);
+}
+
+FileAudioSink::FileAudioSink(std::string fileName, uint32_t sampleRate, AudioFileFormat format)
+: _fileName{std::move(fileName)}
+, _sampleRate{sampleRate}
+, _format{format}
+{
+}
+
+FileAudioSink::~FileAudioSink()
+{
+    if (_file == nullptr) {
+        return;
+    }
+
+    // Sizes are only known now
+    if (_format == AudioFileFormat::Wav) {
+        fseek(_file, 0, SEEK_SET);
+        _writeWavHeader();
+    }
+    fclose(_file);
+}
+
+AudioFileFormat FileAudioSink::getFormat(const std::string& fileName)
+{
+    auto extension = std::string{".wav"};
+    if ((fileName.size() >= extension.size()) &&
+        std::equal(extension.rbegin(), extension.rend(), fileName.rbegin(),
+                   [](char a, char b) { return a == tolower(b); })) {
+        return AudioFileFormat::Wav;
+    }
+
+    return AudioFileFormat::Raw;
+}
+
+bool FileAudioSink::start()
+{
+    if (_file != nullptr) {
+        return true;
+    }
+
+    _file = fopen(_fileName.c_str(), "wb");
+    if (_file == nullptr) {
+        fprintf(stderr, "Failed to open audio file %s\n", _fileName.c_str());
+        return false;
+    }
+
+    if (_format == AudioFileFormat::Wav) {
+        _writeWavHeader();
+    }
+
+    return true;
+}
+
+void FileAudioSink::update()
+{
+    if ((_file == nullptr) || !_readSamples) {
+        return;
+    }
+
+    // Everything produced so far, block by block
+    uint32_t numRead;
+    while ((numRead = _readSamples(_samples, FILE_AUDIO_SINK_BLOCK_SIZE)) > 0) {
+        for (uint32_t index = 0; index < numRead; index++) {
+            _pcmSamples[index] = _isMuted ? 0 : toPcm16(_samples[index]);
+        }
+        fwrite(_pcmSamples, sizeof(int16_t), numRead, _file);
+        _numSamples += numRead;
+    }
+}
+
+void FileAudioSink::_writeWavHeader()
+{
+    // Sizes are capped to what the 32-bit fields hold
+    auto dataSize = static_cast<uint32_t>(std::min<uint64_t>(_numSamples * sizeof(int16_t), UINT32_MAX - wavHeaderSize));
+
+    uint8_t header[wavHeaderSize];
+    memcpy(header, "RIFF", 4);
+    putUint32(header + 4, wavHeaderSize - 8 + dataSize);
+    memcpy(header + 8, "WAVE", 4);
+
+    // Format chunk: PCM, mono, 16 bits
+    memcpy(header + 12, "fmt ", 4);
+    putUint32(header + 16, 16);
+    putUint16(header + 20, 1);
+    putUint16(header + 22, 1);
+    putUint32(header + 24, _sampleRate);
+    putUint32(header + 28, _sampleRate * sizeof(int16_t));
+    putUint16(header + 32, sizeof(int16_t));
+    putUint16(header + 34, 16);
+
+    memcpy(header + 36, "data", 4);
+    putUint32(header + 40, dataSize);
+
+    fwrite(header, 1, wavHeaderSize, _file);
+}
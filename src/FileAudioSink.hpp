@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <stdio.h>
+
+#include "IAudioSink.hpp"
+
+// Samples read from the emulation per write to the file
+#define FILE_AUDIO_SINK_BLOCK_SIZE 1024
+
+enum class AudioFileFormat {
+    // RIFF WAVE, 16-bit mono PCM
+    Wav,
+    // Headerless 16-bit mono little-endian PCM
+    Raw,
+};
+
+// Records audio to a file as it is produced. It is not real time: after every
+// frame it takes all the samples of the frame, so the recording is complete
+// whatever speed the emulation runs at. The WAV header is written with empty
+// sizes first and filled in when the sink goes away.
+class FileAudioSink : public IAudioSink {
+public:
+    FileAudioSink(std::string fileName, uint32_t sampleRate, AudioFileFormat format);
+    ~FileAudioSink();
+
+    /// Pick the format from the file name: WAV for .wav, raw otherwise
+    static AudioFileFormat getFormat(const std::string& fileName);
+
+    /// @name Implementation IAudioSink
+    /// @[
+    uint32_t getSampleRate() const { return _sampleRate; }
+    uint32_t getBlockSize() const { return FILE_AUDIO_SINK_BLOCK_SIZE; }
+    bool isRealTime() const { return false; }
+    void setReadSamplesCallback(std::function<uint32_t(float*, uint32_t)> callback) { _readSamples = callback; }
+    bool start();
+    void update();
+    void setMuted(bool muted) { _isMuted = muted; }
+    /// @]
+
+    /// Samples written so far
+    uint64_t getNumSamples() const { return _numSamples; }
+
+private:
+    void _writeWavHeader();
+
+    std::string _fileName;
+    uint32_t _sampleRate{0};
+    AudioFileFormat _format{AudioFileFormat::Wav};
+
+    FILE* _file{nullptr};
+    uint64_t _numSamples{0};
+
+    float _samples[FILE_AUDIO_SINK_BLOCK_SIZE];
+    int16_t _pcmSamples[FILE_AUDIO_SINK_BLOCK_SIZE];
+    std::atomic<bool> _isMuted{false};
+    std::function<uint32_t(float*, uint32_t)> _readSamples{nullptr};
+};
@@ -0,0 +1,194 @@
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "FrameConverter.hpp"
+
+// NTSC Palette Table: wiki.nesdev.com/w/index.php/PPU_palettes
+constexpr Pixel ntscPalette[PPU_NUM_COLORS] = {
+    {0x54, 0x54, 0x54}, {0x00, 0x1E, 0x74}, {0x08, 0x10, 0x90}, {0x30, 0x00, 0x88},
+    {0x44, 0x00, 0x64}, {0x5C, 0x00, 0x30}, {0x54, 0x04, 0x00}, {0x3C, 0x18, 0x00},
+    {0x20, 0x2A, 0x00}, {0x08, 0x3A, 0x00}, {0x00, 0x40, 0x00}, {0x00, 0x3C, 0x00},
+    {0x00, 0x32, 0x3C}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+    {0x98, 0x96, 0x98}, {0x08, 0x4C, 0xC4}, {0x30, 0x32, 0xEC}, {0x5C, 0x1E, 0xE4},
+    {0x88, 0x14, 0xB0}, {0xA0, 0x14, 0x64}, {0x98, 0x22, 0x20}, {0x78, 0x3C, 0x00},
+    {0x54, 0x5A, 0x00}, {0x28, 0x72, 0x00}, {0x08, 0x7C, 0x00}, {0x00, 0x76, 0x28},
+    {0x00, 0x66, 0x78}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+    {0xEC, 0xEE, 0xEC}, {0x4C, 0x9A, 0xEC}, {0x78, 0x7C, 0xEC}, {0xB0, 0x62, 0xEC},
+    {0xE4, 0x54, 0xEC}, {0xEC, 0x58, 0xB4}, {0xEC, 0x6A, 0x64}, {0xD4, 0x88, 0x20},
+    {0xA0, 0xAA, 0x00}, {0x74, 0xC4, 0x00}, {0x4C, 0xD0, 0x20}, {0x38, 0xCC, 0x6C},
+    {0x38, 0xB4, 0xCC}, {0x3C, 0x3C, 0x3C}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+    {0xEC, 0xEE, 0xEC}, {0xA8, 0xCC, 0xEC}, {0xBC, 0xBC, 0xEC}, {0xD4, 0xB2, 0xEC},
+    {0xEC, 0xAE, 0xEC}, {0xEC, 0xAE, 0xD4}, {0xEC, 0xB4, 0xB0}, {0xE4, 0xC4, 0x90},
+    {0xCC, 0xD2, 0x78}, {0xB4, 0xDE, 0x78}, {0xA8, 0xE2, 0x90}, {0x98, 0xE2, 0xB4},
+    {0xA0, 0xD6, 0xE4}, {0xA0, 0xA2, 0xA0}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+};
+
+// Each emphasis bit attenuates the other two color channels
+constexpr auto emphasisAttenuation = 0.816f;
+
+FrameConverter::FrameConverter()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _hasAVX2 = __builtin_cpu_supports("avx2");
+#endif
+
+    // Pack every color once, so converting a pixel is a single table lookup
+    for (uint8_t emphasis = 0; emphasis < PPU_NUM_EMPHASIS; emphasis++) {
+        for (uint8_t colorIndex = 0; colorIndex < PPU_NUM_COLORS; colorIndex++) {
+            auto pixel = getPixel(colorIndex, emphasis);
+            uint32_t red = pixel.red;
+            uint32_t green = pixel.green;
+            uint32_t blue = pixel.blue;
+
+            _colors[static_cast<int>(PixelFormat::RGB24)][emphasis][colorIndex] = red | (green << 8) | (blue << 16);
+            _colors[static_cast<int>(PixelFormat::RGBA8888)][emphasis][colorIndex] =
+                red | (green << 8) | (blue << 16) | (0xFFu << 24);
+            _colors[static_cast<int>(PixelFormat::BGRA8888)][emphasis][colorIndex] =
+                blue | (green << 8) | (red << 16) | (0xFFu << 24);
+            _colors[static_cast<int>(PixelFormat::RGB565)][emphasis][colorIndex] =
+                ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3);
+        }
+    }
+}
+
+uint32_t FrameConverter::getPixelSize(PixelFormat format)
+{
+    switch (format) {
+    case PixelFormat::RGB24:
+        return 3;
+    case PixelFormat::RGB565:
+        return 2;
+    default:
+        break;
+    }
+
+    return 4;
+}
+
+Pixel FrameConverter::getPixel(uint8_t colorIndex, uint8_t emphasis)
+{
+    auto pixel = ntscPalette[colorIndex & (PPU_NUM_COLORS - 1)];
+    auto red = static_cast<float>(pixel.red);
+    auto green = static_cast<float>(pixel.green);
+    auto blue = static_cast<float>(pixel.blue);
+
+    // Emphasis bits follow PPUMASK order: bit0 red, bit1 green, bit2 blue
+    if (emphasis & 0x01) {
+        green *= emphasisAttenuation;
+        blue *= emphasisAttenuation;
+    }
+    if (emphasis & 0x02) {
+        red *= emphasisAttenuation;
+        blue *= emphasisAttenuation;
+    }
+    if (emphasis & 0x04) {
+        red *= emphasisAttenuation;
+        green *= emphasisAttenuation;
+    }
+
+    return {static_cast<uint8_t>(red), static_cast<uint8_t>(green), static_cast<uint8_t>(blue)};
+}
+
+void FrameConverter::convert(const PpuFrame& frame, PixelFormat format, uint8_t* output) const
+{
+    convert(frame, format, output, 0, PPU_FRAME_HEIGHT);
+}
+
+void FrameConverter::convert(const PpuFrame& frame,
+                             PixelFormat format,
+                             uint8_t* output,
+                             uint32_t firstLine,
+                             uint32_t numLines) const
+{
+    auto lineSize = PPU_FRAME_WIDTH * getPixelSize(format);
+    for (uint32_t line = firstLine; line < firstLine + numLines; line++) {
+        auto pixels = &frame.pixels[line * PPU_FRAME_WIDTH];
+        auto colors = _colors[static_cast<int>(format)][frame.emphasis[line] & (PPU_NUM_EMPHASIS - 1)];
+#if defined(__x86_64__) || defined(__i386__)
+        if (_hasAVX2) {
+            _convertLineAVX2(pixels, colors, format, output + line * lineSize);
+            continue;
+        }
+#endif
+        _convertLine(pixels, colors, format, output + line * lineSize);
+    }
+}
+
+void FrameConverter::_convertLine(const uint8_t* pixels,
+                                  const uint32_t* colors,
+                                  PixelFormat format,
+                                  uint8_t* output) const
+{
+    for (uint32_t x = 0; x < PPU_FRAME_WIDTH; x++) {
+        auto color = colors[pixels[x] & (PPU_NUM_COLORS - 1)];
+        switch (format) {
+        case PixelFormat::RGB24:
+            *output++ = color & 0xFF;
+            *output++ = (color >> 8) & 0xFF;
+            *output++ = (color >> 16) & 0xFF;
+            break;
+        case PixelFormat::RGB565:
+            *reinterpret_cast<uint16_t*>(output) = static_cast<uint16_t>(color);
+            output += 2;
+            break;
+        default:
+            *reinterpret_cast<uint32_t*>(output) = color;
+            output += 4;
+            break;
+        }
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("avx2"))) void FrameConverter::_convertLineAVX2(const uint8_t* pixels,
+                                                                      const uint32_t* colors,
+                                                                      PixelFormat format,
+                                                                      uint8_t* output) const
+{
+    // Eight pixels at a time: widen the indices and gather their packed colors
+    const auto colorMask = _mm256_set1_epi32(PPU_NUM_COLORS - 1);
+    const auto rgbShuffle = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+                                             0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    auto x = uint32_t{0};
+    for (; x + 8 <= PPU_FRAME_WIDTH; x += 8) {
+        auto indices = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pixels + x));
+        auto index = _mm256_and_si256(_mm256_cvtepu8_epi32(indices), colorMask);
+        auto color = _mm256_i32gather_epi32(reinterpret_cast<const int*>(colors), index, 4);
+
+        switch (format) {
+        case PixelFormat::RGB24:
+        {
+            // The second 16-byte store would overrun the end of the line on
+            // the last group, leave that one to the scalar tail below.
+            if (x + 8 == PPU_FRAME_WIDTH) {
+                break;
+            }
+            auto packed = _mm256_shuffle_epi8(color, rgbShuffle);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + x * 3), _mm256_castsi256_si128(packed));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + x * 3 + 12), _mm256_extracti128_si256(packed, 1));
+            break;
+        }
+        case PixelFormat::RGB565:
+        {
+            auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(color, color), 0x08);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + x * 2), _mm256_castsi256_si128(packed));
+            break;
+        }
+        default:
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + x * 4), color);
+            break;
+        }
+    }
+
+    if (format == PixelFormat::RGB24) {
+        // Scalar tail for the last group of pixels
+        for (x = PPU_FRAME_WIDTH - 8; x < PPU_FRAME_WIDTH; x++) {
+            auto color = colors[pixels[x] & (PPU_NUM_COLORS - 1)];
+            output[x * 3 + 0] = color & 0xFF;
+            output[x * 3 + 1] = (color >> 8) & 0xFF;
+            output[x * 3 + 2] = (color >> 16) & 0xFF;
+        }
+    }
+}
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Ppu.hpp"
+
+#define PPU_NUM_COLORS 64
+#define PPU_NUM_EMPHASIS 8
+
+enum class PixelFormat {
+    RGB24,
+    RGBA8888,
+    BGRA8888,
+    RGB565,
+};
+
+// Converts the palette-indexed frame emitted by the PPU into a packed pixel
+// format that can be handed to a display. The conversion is a separate pass
+// so that consumers who only need the indices (e.g. hashing a frame) never
+// pay for it.
+class FrameConverter {
+public:
+    FrameConverter();
+
+    /// Convert a whole PPU frame
+    /// @param frame - palette-indexed frame from the PPU
+    /// @param format - which pixel format to write
+    /// @param output - destination, getFrameSize(format) bytes long
+    void convert(const PpuFrame& frame, PixelFormat format, uint8_t* output) const;
+
+    /// Convert some scanlines of a PPU frame only
+    /// @param output - destination of the whole frame, only the converted
+    ///                 lines are written
+    void convert(const PpuFrame& frame,
+                 PixelFormat format,
+                 uint8_t* output,
+                 uint32_t firstLine,
+                 uint32_t numLines) const;
+
+    /// Bytes needed to hold one converted frame
+    static uint32_t getFrameSize(PixelFormat format) { return PPU_FRAME_BUFFER_SIZE * getPixelSize(format); }
+    static uint32_t getPixelSize(PixelFormat format);
+
+    /// Get the RGB color of a single NES color index
+    static Pixel getPixel(uint8_t colorIndex, uint8_t emphasis = 0);
+
+private:
+    void _convertLine(const uint8_t* pixels, const uint32_t* colors, PixelFormat format, uint8_t* output) const;
+    void _convertLineAVX2(const uint8_t* pixels, const uint32_t* colors, PixelFormat format, uint8_t* output) const;
+
+    bool _hasAVX2{false};
+
+    // Packed colors for every format, emphasis and color index
+    uint32_t _colors[4][PPU_NUM_EMPHASIS][PPU_NUM_COLORS];
+};
@@ -0,0 +1,129 @@
+#include <time.h>
+#include <errno.h>
+
+#include "FramePacer.hpp"
+
+constexpr uint64_t nanosecondsPerSecond = 1000000000ull;
+
+// Default time spent spinning before each deadline, this covers the usual
+// wake-up latency of a sleeping thread
+constexpr uint32_t defaultSpinTime = 500;
+
+// Frames the pacer may fall behind before it gives up catching up
+constexpr uint64_t maxFramesBehind = 3;
+
+FramePacer::FramePacer(double frameRate)
+{
+    setFrameRate(frameRate);
+    setSpinTime(defaultSpinTime);
+    resetStats();
+}
+
+void FramePacer::setFrameRate(double frameRate)
+{
+    _period = (frameRate > 0.0) ? static_cast<uint64_t>(nanosecondsPerSecond / frameRate) : 0;
+}
+
+void FramePacer::wait()
+{
+    if (_isPaused) {
+        std::unique_lock<std::mutex> lock(_pauseMutex);
+        _pauseChanged.wait(lock, [this] { return !_isPaused; });
+
+        // Start over, rather than rushing through the frames we missed
+        _deadline = 0;
+    }
+
+    auto period = _period.load();
+    if (period == 0) {
+        // Not pacing, start over once we are again
+        _deadline = 0;
+        return;
+    }
+
+    auto now = _getTime();
+    if ((_deadline == 0) || (now > _deadline + maxFramesBehind * period)) {
+        // First frame, or we are way behind (e.g. the host was busy)
+        if (_deadline != 0) {
+            _resyncs++;
+        }
+        _deadline = now + period;
+        return;
+    }
+
+    // Sleep most of the way, then spin up to the deadline
+    auto spinTime = _spinTime.load();
+    if (_deadline > now + spinTime) {
+        _sleepUntil(_deadline - spinTime);
+    }
+    do {
+        now = _getTime();
+    } while (now < _deadline);
+
+    _addJitter(now - _deadline);
+    _deadline += period;
+}
+
+void FramePacer::setPaused(bool paused)
+{
+    {
+        std::lock_guard<std::mutex> lock(_pauseMutex);
+        _isPaused = paused;
+    }
+    _pauseChanged.notify_all();
+}
+
+FramePacerStats FramePacer::getStats() const
+{
+    FramePacerStats stats;
+    stats.frames = _frames;
+    stats.resyncs = _resyncs;
+    stats.maxJitter = _maxJitter;
+    for (uint8_t bucket = 0; bucket < FRAME_PACER_HISTOGRAM_SIZE; bucket++) {
+        stats.histogram[bucket] = _histogram[bucket];
+    }
+    return stats;
+}
+
+void FramePacer::resetStats()
+{
+    _frames = 0;
+    _resyncs = 0;
+    _maxJitter = 0;
+    for (auto& count : _histogram) {
+        count = 0;
+    }
+}
+
+uint64_t FramePacer::_getTime() const
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec * nanosecondsPerSecond + time.tv_nsec;
+}
+
+void FramePacer::_sleepUntil(uint64_t time) const
+{
+    struct timespec deadline;
+    deadline.tv_sec = time / nanosecondsPerSecond;
+    deadline.tv_nsec = time % nanosecondsPerSecond;
+
+    // Absolute deadline, so being interrupted just means sleeping again
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR) {
+    }
+}
+
+void FramePacer::_addJitter(uint64_t jitter)
+{
+    auto microseconds = jitter / 1000;
+    auto bucket = uint8_t{0};
+    while (microseconds >= framePacerBucketLimits[bucket]) {
+        bucket++;
+    }
+    _histogram[bucket]++;
+    _frames++;
+
+    if (jitter > _maxJitter) {
+        _maxJitter = jitter;
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+// NTSC NES frame rate: 21.477272 MHz / 4 / (341 * 262 - 0.5)
+#define NTSC_FRAME_RATE 60.0988
+
+// Frame jitter histogram buckets, upper limit (exclusive) of each bucket in
+// microseconds.
+// The last bucket takes everything above.
+#define FRAME_PACER_HISTOGRAM_SIZE 9
+constexpr uint32_t framePacerBucketLimits[FRAME_PACER_HISTOGRAM_SIZE] = {
+    10, 20, 50, 100, 200, 500, 1000, 2000, UINT32_MAX,
+};
+
+struct FramePacerStats {
+    // Frames paced so far
+    uint64_t frames;
+    // Times the pacer fell too far behind and restarted its clock
+    uint64_t resyncs;
+    // Worst jitter seen, in nanoseconds
+    uint64_t maxJitter;
+    // Frames per jitter bucket (see framePacerBucketLimits)
+    uint64_t histogram[FRAME_PACER_HISTOGRAM_SIZE];
+};
+
+// Paces the emulation thread to a fixed frame rate. Each frame has an absolute
+// deadline: the pacer sleeps with clock_nanosleep until shortly before it and
+// spins for the rest, which is a lot more precise than sleeping all the way
+// and a lot cheaper than spinning all the way. Jitter (how late a frame really
+// starts) is collected into a histogram.
+class FramePacer {
+public:
+    FramePacer(double frameRate = NTSC_FRAME_RATE);
+
+    /// Frames per second to pace to, 0 to not pace at all
+    void setFrameRate(double frameRate);
+
+    /// How long to spin before each deadline instead of sleeping
+    void setSpinTime(uint32_t microseconds) { _spinTime = microseconds * 1000ull; }
+
+    /// Block until the next frame is due. While paused, it blocks without
+    /// using the CPU until resumed.
+    void wait();
+
+    /// Pause or resume pacing, e.g. while the window is hidden
+    void setPaused(bool paused);
+    bool isPaused() const { return _isPaused; }
+
+    FramePacerStats getStats() const;
+    void resetStats();
+
+private:
+    uint64_t _getTime() const;
+    void _sleepUntil(uint64_t time) const;
+    void _addJitter(uint64_t jitter);
+
+    std::atomic<uint64_t> _period{0};
+    std::atomic<uint64_t> _spinTime{0};
+    uint64_t _deadline{0};
+
+    std::mutex _pauseMutex;
+    std::condition_variable _pauseChanged;
+    std::atomic<bool> _isPaused{false};
+
+    // Statistics, written by the paced thread and read from anywhere
+    std::atomic<uint64_t> _frames{0};
+    std::atomic<uint64_t> _resyncs{0};
+    std::atomic<uint64_t> _maxJitter{0};
+    std::atomic<uint64_t> _histogram[FRAME_PACER_HISTOGRAM_SIZE];
+};
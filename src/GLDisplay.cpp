@@ -0,0 +1,219 @@
+#include <stdio.h>
+
+// Core profile entry points are exported by libGL, no loader needed
+#define GL_GLEXT_PROTOTYPES
+
+#include "GLDisplay.hpp"
+
+// One triangle twice the size of the viewport, so the viewport is covered with
+// no diagonal seam. Texture coordinates run top to bottom like frame lines.
+static const char* vertexShaderSource = R"(#version 330 core
+out vec2 texCoord;
+void main()
+{
+    vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    texCoord = vec2(position.x, 1.0 - position.y);
+    gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+static const char* fragmentShaderSource = R"(#version 330 core
+uniform sampler2D image;
+in vec2 texCoord;
+out vec4 color;
+void main()
+{
+    color = texture(image, texCoord);
+}
+)";
+
+// Longest wait for the GPU to release a pixel buffer
+constexpr GLuint64 fenceTimeout = 100000000;
+
+GLDisplay::GLDisplay(uint32_t frameWidth, uint32_t frameHeight)
+: _frameWidth{frameWidth}
+, _frameHeight{frameHeight}
+{
+}
+
+GLDisplay::~GLDisplay()
+{
+    for (auto& fence : _fences) {
+        if (fence) {
+            glDeleteSync(fence);
+        }
+    }
+    glDeleteBuffers(DISPLAY_NUM_PIXEL_BUFFERS, _pixelBuffers);
+    glDeleteTextures(1, &_frameTexture);
+    glDeleteTextures(1, &_sidebarTexture);
+    glDeleteVertexArrays(1, &_vertexArray);
+    glDeleteProgram(_program);
+}
+
+bool GLDisplay::initialize()
+{
+    auto vertexShader = _compileShader(GL_VERTEX_SHADER, vertexShaderSource);
+    auto fragmentShader = _compileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
+    if (!vertexShader || !fragmentShader) {
+        return false;
+    }
+
+    _program = glCreateProgram();
+    glAttachShader(_program, vertexShader);
+    glAttachShader(_program, fragmentShader);
+    glLinkProgram(_program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    auto isLinked = GLint{GL_FALSE};
+    glGetProgramiv(_program, GL_LINK_STATUS, &isLinked);
+    if (!isLinked) {
+        char log[512];
+        glGetProgramInfoLog(_program, sizeof(log), nullptr, log);
+        fprintf(stderr, "GLDisplay shader link failed: %s\n", log);
+        return false;
+    }
+
+    // Vertices come from gl_VertexID, but core profile draws need a vertex array
+    glGenVertexArrays(1, &_vertexArray);
+
+    glGenTextures(1, &_frameTexture);
+    glBindTexture(GL_TEXTURE_2D, _frameTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, _frameWidth, _frameHeight, 0, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV,
+                 nullptr);
+
+    glGenBuffers(DISPLAY_NUM_PIXEL_BUFFERS, _pixelBuffers);
+    for (auto pixelBuffer : _pixelBuffers) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, _frameWidth * _frameHeight * 4, nullptr, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    return true;
+}
+
+void GLDisplay::setSidebar(const uint8_t* pixels, uint32_t width, uint32_t height)
+{
+    if (!_sidebarTexture) {
+        glGenTextures(1, &_sidebarTexture);
+    }
+    _sidebarWidth = width;
+
+    glBindTexture(GL_TEXTURE_2D, _sidebarTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+    // RGB24 lines are not 4-byte aligned
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+uint8_t* GLDisplay::mapFrame()
+{
+    // Wait for the upload that last read from this buffer, it was started
+    // DISPLAY_NUM_PIXEL_BUFFERS frames ago so it is normally long done
+    auto& fence = _fences[_pixelBufferIndex];
+    auto isIdle = true;
+    if (fence) {
+        auto result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, fenceTimeout);
+        isIdle = (result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED);
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    // The previous content is not needed, and once the GPU is done with it
+    // there is nothing to synchronize with. If the wait timed out or failed,
+    // let the driver synchronize instead.
+    auto access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT;
+    if (isIdle) {
+        access |= GL_MAP_UNSYNCHRONIZED_BIT;
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _pixelBuffers[_pixelBufferIndex]);
+    auto pixels = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, _frameWidth * _frameHeight * 4, access);
+    if (pixels == nullptr) {
+        // Other texture uploads must not read from the buffer
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+    return static_cast<uint8_t*>(pixels);
+}
+
+void GLDisplay::unmapFrame(const uint8_t* dirtyLines)
+{
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+    // Texture update reads from the bound pixel buffer, the pointer is an
+    // offset into it. Lines left out keep what the texture had.
+    glBindTexture(GL_TEXTURE_2D, _frameTexture);
+    auto line = uint32_t{0};
+    while (line < _frameHeight) {
+        if (dirtyLines && !dirtyLines[line]) {
+            line++;
+            continue;
+        }
+
+        auto firstLine = line;
+        while ((line < _frameHeight) && (!dirtyLines || dirtyLines[line])) {
+            line++;
+        }
+        auto offset = static_cast<uintptr_t>(firstLine * _frameWidth * 4);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, firstLine, _frameWidth, line - firstLine, GL_BGRA,
+                        GL_UNSIGNED_INT_8_8_8_8_REV, reinterpret_cast<const void*>(offset));
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    _fences[_pixelBufferIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    _pixelBufferIndex = (_pixelBufferIndex + 1) % DISPLAY_NUM_PIXEL_BUFFERS;
+}
+
+void GLDisplay::draw(uint32_t windowWidth, uint32_t windowHeight)
+{
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glUseProgram(_program);
+    glBindVertexArray(_vertexArray);
+    glActiveTexture(GL_TEXTURE0);
+
+    // Stretch the frame and its sidebars over the window
+    auto scale = static_cast<float>(windowWidth) / getWidth();
+    auto sidebarWidth = static_cast<GLsizei>(_sidebarWidth * scale);
+    auto frameWidth = static_cast<GLsizei>(windowWidth) - 2 * sidebarWidth;
+
+    if (_sidebarTexture) {
+        glBindTexture(GL_TEXTURE_2D, _sidebarTexture);
+        glViewport(0, 0, sidebarWidth, windowHeight);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glViewport(sidebarWidth + frameWidth, 0, sidebarWidth, windowHeight);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, _frameTexture);
+    glViewport(sidebarWidth, 0, frameWidth, windowHeight);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+GLuint GLDisplay::_compileShader(GLenum type, const char* source)
+{
+    auto shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    auto isCompiled = GLint{GL_FALSE};
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
+    if (!isCompiled) {
+        char log[512];
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        fprintf(stderr, "GLDisplay shader compile failed: %s\n", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+
+    return shader;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+
+#include "GL/gl.h"
+#include "GL/glext.h"
+
+// Number of pixel buffers frames are streamed through
+#define DISPLAY_NUM_PIXEL_BUFFERS 2
+
+// OpenGL 3.3 core profile presentation of the NES frame.
+//
+// Frames are written straight into a mapped pixel buffer object, in BGRA which
+// is what GPUs take without any conversion, and the texture is updated from
+// that buffer asynchronously. Pixel buffers are used in turns, and a fence
+// tells when the GPU is done with a buffer so it can be written again without
+// stalling the pipeline. The texture is then drawn with a single triangle that
+// covers the viewport.
+//
+// All methods must be called from the thread owning the GL context.
+class GLDisplay {
+public:
+    GLDisplay(uint32_t frameWidth, uint32_t frameHeight);
+    ~GLDisplay();
+
+    /// Create all GL objects, needs a current OpenGL 3.3 core context
+    /// @return false if the shaders could not be built
+    bool initialize();
+
+    /// Static image shown on both sides of the frame
+    /// @param pixels - RGB24 pixels, copied to a texture of its own at once
+    void setSidebar(const uint8_t* pixels, uint32_t width, uint32_t height);
+
+    /// Full width, sidebars included, the frame is drawn at
+    uint32_t getWidth() const { return _frameWidth + 2 * _sidebarWidth; }
+    uint32_t getHeight() const { return _frameHeight; }
+
+    /// Get a pixel buffer to write the next frame into
+    /// @return frameWidth * frameHeight BGRA8888 pixels, nullptr if the buffer
+    ///         could not be mapped, then unmapFrame() must not be called
+    uint8_t* mapFrame();
+
+    /// Hand the frame written since mapFrame() over to the GPU
+    /// @param dirtyLines - non-zero for every line written since mapFrame(),
+    ///                     nullptr if all of them were
+    void unmapFrame(const uint8_t* dirtyLines = nullptr);
+
+    /// Draw the latest frame, stretched over the whole window
+    void draw(uint32_t windowWidth, uint32_t windowHeight);
+
+private:
+    GLuint _compileShader(GLenum type, const char* source);
+
+    uint32_t _frameWidth{0};
+    uint32_t _frameHeight{0};
+    uint32_t _sidebarWidth{0};
+
+    GLuint _program{0};
+    GLuint _vertexArray{0};
+    GLuint _frameTexture{0};
+    GLuint _sidebarTexture{0};
+
+    // Pixel buffers and the fences of the uploads reading from them
+    GLuint _pixelBuffers[DISPLAY_NUM_PIXEL_BUFFERS]{};
+    GLsync _fences[DISPLAY_NUM_PIXEL_BUFFERS]{};
+    uint32_t _pixelBufferIndex{0};
+};
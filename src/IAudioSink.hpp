@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+// 16-bit samples are scaled a little short of full scale, so rounding never
+// wraps around
+constexpr auto audioSampleMaxResolution = 32760.0f;
+
+class IAudioSink {
+public:
+    virtual ~IAudioSink() = default;
+
+    /// Rate the sink takes samples at
+    virtual uint32_t getSampleRate() const = 0;
+
+    /// Number of samples the sink reads at once
+    virtual uint32_t getBlockSize() const = 0;
+
+    /// Whether the sink plays samples as time passes (e.g. a sound card), as
+    /// opposed to taking every sample as soon as it is produced. Only the
+    /// former needs samples buffered ahead and rate control.
+    virtual bool isRealTime() const = 0;
+
+    /// Whether samples are thrown away anyway, so there is no need to
+    /// produce them
+    virtual bool isDiscarding() const { return false; }
+
+    /// Called to read samples. It returns the number of samples it filled
+    /// in, fewer than asked for when running short. Set it before start().
+    virtual void setReadSamplesCallback(std::function<uint32_t(float*, uint32_t)> callback) = 0;
+
+    /// Start taking samples
+    /// @return bool - if the output could be started or not
+    virtual bool start() = 0;
+
+    /// Called by the emulation after every frame. Sinks that are not real
+    /// time read the samples of the frame here.
+    virtual void update() {}
+
+    /// Output silence instead of the samples read
+    virtual void setMuted(bool muted) = 0;
+};
+
+// Convert a sample to 16 bits, clipping it to [-1, 1]
+inline int16_t toPcm16(float sample)
+{
+    if (sample >= 0.0f) {
+        return static_cast<int16_t>((sample < 1.0f ? sample : 1.0f) * audioSampleMaxResolution);
+    }
+    return static_cast<int16_t>((sample > -1.0f ? sample : -1.0f) * audioSampleMaxResolution);
+}
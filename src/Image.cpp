@@ -0,0 +1,37 @@
+#include <fstream>
+#include <utility>
+
+#include "Image.hpp"
+
+bool Image::load(const std::string& fileName)
+{
+    _width = 0;
+    _height = 0;
+    _pixels.clear();
+
+    auto file = std::ifstream{fileName, std::ifstream::binary};
+    auto magic = std::string{};
+    auto width = uint32_t{0};
+    auto height = uint32_t{0};
+    auto maxValue = uint32_t{0};
+    file >> magic >> width >> height >> maxValue;
+    if (!file || (magic != "P6") || (maxValue != 255)) {
+        return false;
+    }
+    if ((width == 0) || (height == 0) || (width > IMAGE_MAX_SIZE) || (height > IMAGE_MAX_SIZE)) {
+        return false;
+    }
+
+    // Exactly one whitespace separates the header from the pixels
+    file.get();
+    auto pixels = std::vector<uint8_t>(static_cast<size_t>(width) * height * 3);
+    file.read(reinterpret_cast<char*>(pixels.data()), pixels.size());
+    if (!file) {
+        return false;
+    }
+
+    _width = width;
+    _height = height;
+    _pixels = std::move(pixels);
+    return true;
+}
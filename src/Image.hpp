@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Largest width or height accepted, anything bigger is a broken header rather
+// than a picture worth a texture
+#define IMAGE_MAX_SIZE 4096
+
+// RGB24 image loaded from a binary PPM (P6) file, the simplest format that
+// still carries its own dimensions
+class Image {
+public:
+    /// @return false if the file is missing, not an 8-bit binary PPM (header
+    ///         comments are not supported) or too large, the image is then
+    ///         left empty
+    bool load(const std::string& fileName);
+
+    uint32_t getWidth() const { return _width; }
+    uint32_t getHeight() const { return _height; }
+    const uint8_t* getPixels() const { return _pixels.data(); }
+
+private:
+    uint32_t _width{0};
+    uint32_t _height{0};
+    std::vector<uint8_t> _pixels;
+};
@@ -21,17 +21,9 @@ bool Mapper000::readPrg(uint16_t address, uint32_t& prgAddress, uint8_t& /*data*
     return false;
 }
 
-bool Mapper000::writePrg(uint16_t address, uint32_t& prgAddress, uint8_t /*data*/)
+bool Mapper000::writePrg(uint16_t /*address*/, uint32_t& /*prgAddress*/, uint8_t /*data*/)
 {
-    if (address >= 0x8000 && address <= 0xFFFF) {
-        if (_prgRomChunks > 1) {
-            prgAddress = address & 0x7FFF;
-        } else {
-            prgAddress = address & 0x3FFF;
-        }
-        return true;
-    }
-
+    // No registers, and program memory is ROM
     return false;
 }
 
@@ -4,10 +4,16 @@
 
 #include "IMemory.hpp"
 
+#define NAME_TABLE_PAGE_SIZE 0x400
+#define NAME_TABLE_NUM_PAGES 4
+
 class NameTable : public IMemory {
 public:
     NameTable();
 
+    /// Direct access to one of the four 1KB nametable pages
+    uint8_t* getPage(uint8_t page) { return &_memory[(page % NAME_TABLE_NUM_PAGES) * NAME_TABLE_PAGE_SIZE]; }
+
     /// @name Implementation IMemory
     /// @[
     bool write(uint16_t address, uint8_t data);
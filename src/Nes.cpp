@@ -1,32 +1,239 @@
+#include <algorithm>
+
 #include "Nes.hpp"
 
+// CPU cycles lost to a DMC sample fetch, the usual case of the 1 to 4 it can take
+constexpr uint8_t dmcStallCycles = 4;
+
+// How many frames are emulated in the time of one, 0 for as many as possible
+static double getSpeedMultiplier(EmulationSpeed speed)
+{
+    switch (speed) {
+    case EmulationSpeed::SlowMotion:
+        return 0.5;
+    case EmulationSpeed::Turbo2x:
+        return 2;
+    case EmulationSpeed::Turbo4x:
+        return 4;
+    case EmulationSpeed::Turbo8x:
+        return 8;
+    case EmulationSpeed::Unlimited:
+        return 0;
+    default:
+        break;
+    }
+
+    return 1;
+}
+
 Nes::Nes() {}
 
-Nes::~Nes() {}
+Nes::~Nes()
+{
+    stop();
+}
 
-void Nes::load(std::string fileName)
+bool Nes::load(std::string fileName)
 {
     _fileName = std::move(fileName);
 
+    _cartridge = std::make_shared<Cartridge>(_fileName);
+    if (!_cartridge->isValid()) {
+        fprintf(stderr, "Failed to load NES ROM %s\n", _fileName.c_str());
+        return false;
+    }
+
     _cpuRam = std::make_shared<Memory2KB>();
     _apu = std::make_shared<Apu>();
     _controller = std::make_shared<Controller>();
 
     _nameTable = std::make_shared<NameTable>();
     _paletteTable = std::make_shared<PaletteTable>();
-    _cartridge = std::make_shared<Cartridge>(_fileName);
 
     _ppuBus = std::make_shared<PpuBus>(_nameTable, _paletteTable, _cartridge);
     _ppu = std::make_shared<Ppu>(_ppuBus, _cartridge);
 
     _cpuBus = std::make_shared<CpuBus>(_cpuRam, _apu, _ppu, _cartridge, _controller);
     _cpu = std::make_shared<Cpu>(_cpuBus, _ppu);
+    _cpuBus->setPpuSyncCallback([this]() { _syncPpu(); });
+    _cpuBus->setPpuStatusCallback([this](uint8_t& data) { return _ppu->readStatusAhead(_ppuPendingCycles, data); });
+    _apu->setDmcReadCallback([this](uint16_t address) {
+        // The CPU waits while the DMC has the bus
+        _cpu->stall(dmcStallCycles);
+        auto data = uint8_t{0x00};
+        _cpuBus->read(address, data);
+        return data;
+    });
+
+    if (!_audioSink) {
+        _audioSink = std::make_shared<AudioHw>(NES_AUDIO_SAMPLE_RATE, _audioNumBlocks, _audioBlockSize);
+    }
+    _setupAudio();
+    if (!_audioSink->start()) {
+        // Carry on without sound
+        _audioSink = std::make_shared<NullAudioSink>(NES_AUDIO_SAMPLE_RATE);
+        _setupAudio();
+    }
 
-    _audioHw = std::make_shared<AudioHw>(44100, 8, 512);
-    _audioHw->setReadSampleCallback([this](float time) { return _apu->getMixedOutput(time); });
+    return true;
+}
+
+void Nes::setAudioBuffer(uint32_t numBlocks, uint32_t blockSize)
+{
+    // One block plays while the next is filled
+    _audioNumBlocks = std::min(std::max(numBlocks, 2u), static_cast<uint32_t>(NES_AUDIO_MAX_BLOCKS));
+    _audioBlockSize = std::min(std::max(blockSize, 64u), static_cast<uint32_t>(NES_AUDIO_MAX_BLOCK_SIZE));
+}
+
+void Nes::_setupAudio()
+{
+    _apu->setSyncMode(_apuSyncMode);
+    _apu->setSampleRate(_audioSink->getSampleRate());
+    _apu->setSampleOutput(!_audioSink->isDiscarding());
+
+    auto apu = _apu;
+    if (_audioSink->isRealTime()) {
+        // Played in real time, the tempo follows the emulation speed
+        _timeStretch = std::make_shared<TimeStretch>(_audioSink->getSampleRate());
+        _timeStretch->setReadSamplesCallback([apu](float* samples, uint32_t count) { return apu->readSamples(samples, count); });
+
+        auto timeStretch = _timeStretch;
+        _audioSink->setReadSamplesCallback([timeStretch](float* samples, uint32_t count) { return timeStretch->readSamples(samples, count); });
+    } else {
+        _timeStretch.reset();
+        _apu->setTargetSamples(0);
+        _audioSink->setReadSamplesCallback([apu](float* samples, uint32_t count) { return apu->readSamples(samples, count); });
+    }
+
+    _updateAudioSpeed();
+}
+
+void Nes::_updateAudioSpeed()
+{
+    auto multiplier = getSpeedMultiplier(_speed);
+
+    if (_timeStretch) {
+        // As fast as possible is at least as fast as it goes
+        _timeStretch->setSpeed((multiplier == 0.0) ? TIME_STRETCH_MAX_SPEED : multiplier);
+
+        // Frames are emulated in bursts, so the samples buffered ahead of a
+        // real time sink have to ride out a frame of them on top of a couple
+        // of blocks, and whatever the stretcher takes at once
+        auto sampleRate = _audioSink->getSampleRate();
+        auto samplesPerFrame = static_cast<uint32_t>(sampleRate / NTSC_FRAME_RATE);
+        _apu->setTargetSamples(2 * _audioSink->getBlockSize() + samplesPerFrame +
+                               _timeStretch->getInputChunk(_timeStretch->getSpeed()));
+    }
+
+    // Only real time output plays at the emulation speed, and beyond what
+    // the stretcher handles it is just noise. Other sinks take every sample
+    // as it was produced, whatever the speed.
+    auto isAudible = !_audioSink->isRealTime() || TimeStretch::isSupportedSpeed(multiplier);
+    _audioSink->setMuted(!isAudible);
 }
 
 void Nes::renderFrame()
+{
+    // Frames the display is not going to get do not need any pixels
+    auto isShown = _isFrameShown();
+    _ppu->setPixelOutput(isShown || !_turboSkipsPixels);
+
+    // Switch between frames, after settling any owed PPU cycles
+    auto ppuSyncMode = _requestedPpuSyncMode.load();
+    if (ppuSyncMode != _ppuSyncMode) {
+        _syncPpu();
+        _ppuSyncMode = ppuSyncMode;
+    }
+
+    if (_ppuSyncMode == PpuSyncMode::Lazy) {
+        _renderFrameLazy();
+    } else {
+        _renderFrameLockstep();
+    }
+
+    if (isShown) {
+        // Hand a copy of the completed frame over, the PPU keeps drawing into its own
+        _frames.getWriteBuffer() = _ppu->getFrame();
+        _frames.publish();
+
+        // Drawn here, where the PPU memory cannot change under the views
+        if (_isDebugViewsEnabled) {
+            auto& debug = _ppu->getDebug();
+            debug.setPatternTablePalette(_debugPatternTablePalette);
+            debug.update();
+            debug.copyViews(_debugViews->getWriteBuffer());
+            _debugViews->publish();
+        }
+    }
+
+    _audioSink->update();
+}
+
+void Nes::setSpeed(EmulationSpeed speed)
+{
+    auto multiplier = getSpeedMultiplier(speed);
+
+    _speed = speed;
+    _framePacer.setFrameRate(NTSC_FRAME_RATE * multiplier);
+
+    if (_audioSink) {
+        _updateAudioSpeed();
+    }
+}
+
+void Nes::start()
+{
+    if (_isRunning) {
+        return;
+    }
+
+    _isRunning = true;
+    _emulationThread = std::make_unique<std::thread>([this] {
+        while (_isRunning) {
+            _framePacer.wait();
+            if (!_isRunning) {
+                break;
+            }
+            renderFrame();
+        }
+    });
+}
+
+void Nes::stop()
+{
+    if (!_emulationThread) {
+        return;
+    }
+
+    // A paused pacer would keep the thread waiting, let it go for the join
+    auto isPaused = _framePacer.isPaused();
+    _isRunning = false;
+    _framePacer.setPaused(false);
+    _emulationThread->join();
+    _emulationThread.reset();
+    _framePacer.setPaused(isPaused);
+}
+
+bool Nes::updateFrame()
+{
+    return _frames.update();
+}
+
+void Nes::setDebugViewsEnabled(bool enabled)
+{
+    // The buffers have to exist before the emulation thread sees the flag
+    if (enabled && !_debugViews) {
+        _debugViews = std::make_unique<TripleBuffer<PpuDebugViews>>();
+    }
+    _isDebugViewsEnabled = enabled;
+}
+
+bool Nes::updateDebugViews()
+{
+    return _debugViews && _debugViews->update();
+}
+
+void Nes::_renderFrameLockstep()
 {
     while (!_ppu->isFrameDone()) {
         // One PPU cycle
@@ -44,10 +251,51 @@ void Nes::renderFrame()
         if (_counter % 6 == 0) {
             // One APU cycle
             _apu->tick();
+            _cpu->setInterruptLine(_apu->isInterruptRequested());
+        }
+
+        // Wrap at a multiple of 6, so that CPU and APU keep their rates and
+        // odd and even CPU cycles keep alternating
+        _counter++;
+        if (_counter >= 0xFC) {
+            _counter = 0;
+        }
+
+        // Check if PPU need to send NMI to CPU
+        if (_ppu->isVBlankTriggered()) {
+            _cpu->nonMaskableInterruptRequest();
+        }
+    }
+}
+
+void Nes::_renderFrameLazy()
+{
+    while (!_ppu->isFrameDone()) {
+        // One PPU cycle, only owed until somebody needs the PPU state
+        _ppuPendingCycles++;
+        if ((_ppuPendingCycles >= _ppuCyclesToEvent) || _cpu->isDMAActive()) {
+            _syncPpu();
+        }
+
+        // PPU runs 3 times faster than CPU
+        if (_counter % 3 == 0) {
+            auto isOddCycle = (_counter % 2 == 1);
+
+            // One CPU cycle, PPU register access catches the PPU up first
+            _cpu->tick(isOddCycle);
+        }
+
+        // PPU runs 6 times faster than APU
+        if (_counter % 6 == 0) {
+            // One APU cycle
+            _apu->tick();
+            _cpu->setInterruptLine(_apu->isInterruptRequested());
         }
 
+        // Wrap at a multiple of 6, so that CPU and APU keep their rates and
+        // odd and even CPU cycles keep alternating
         _counter++;
-        if (_counter >= 0xFF) {
+        if (_counter >= 0xFC) {
             _counter = 0;
         }
 
@@ -58,17 +306,66 @@ void Nes::renderFrame()
     }
 }
 
+bool Nes::_isFrameShown()
+{
+    auto multiplier = getSpeedMultiplier(_speed);
+    if ((multiplier > 0.0) && (multiplier <= 1.0)) {
+        return true;
+    }
+
+    if (multiplier == 0.0) {
+        // Frame rate is unknown, show a frame once a display period passed
+        auto now = std::chrono::steady_clock::now();
+        if (now - _lastShownTime < std::chrono::duration<double>(1.0 / NTSC_FRAME_RATE)) {
+            return false;
+        }
+        _lastShownTime = now;
+        return true;
+    }
+
+    // Show one frame out of every few, which keeps the display at 60 Hz
+    return (_turboFrameCount++ % static_cast<uint32_t>(multiplier)) == 0;
+}
+
+void Nes::_syncPpu()
+{
+    while (_ppuPendingCycles > 0) {
+        _ppuPendingCycles -= _ppu->advance(_ppuPendingCycles);
+    }
+    _ppuCyclesToEvent = _ppu->getCyclesToNextEvent();
+}
+
 void Nes::reset()
 {
     _cartridge->reset();
     _cpu->reset();
     _ppu->reset();
     _counter = 0;
+    _ppuPendingCycles = 0;
+    _ppuCyclesToEvent = _ppu->getCyclesToNextEvent();
 }
 
 uint8_t* Nes::getFrameBuffer()
 {
-    return _ppu->getFrameBuffer();
+    // Only convert to RGB when somebody actually asks for it
+    _frameBufferRGB.resize(FrameConverter::getFrameSize(PixelFormat::RGB24));
+    _frameConverter.convert(_frames.getReadBuffer(), PixelFormat::RGB24, _frameBufferRGB.data());
+    return _frameBufferRGB.data();
+}
+
+const PpuFrame& Nes::getFrame() const
+{
+    return _frames.getReadBuffer();
+}
+
+void Nes::convertFrame(PixelFormat format, uint8_t* output) const
+{
+    _frameConverter.convert(_frames.getReadBuffer(), format, output);
+}
+
+void Nes::convertFrame(PixelFormat format, uint8_t* output, uint32_t firstLine, uint32_t numLines) const
+{
+    _frameConverter.convert(_frames.getReadBuffer(), format, output, firstLine, numLines);
 }
 
 void Nes::setControllerKey(uint8_t id, NesButton button, bool state)
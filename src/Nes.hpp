@@ -1,8 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <atomic>
+#include <thread>
+#include <chrono>
 
 #include "AudioHw.hpp"
+#include "NullAudioSink.hpp"
 #include "Memory2KB.hpp"
 #include "Controller.hpp"
 #include "CpuBus.hpp"
@@ -12,7 +16,21 @@
 #include "Cartridge.hpp"
 #include "Apu.hpp"
 #include "Ppu.hpp"
+#include "PpuDebug.hpp"
 #include "Cpu.hpp"
+#include "FrameConverter.hpp"
+#include "TripleBuffer.hpp"
+#include "FramePacer.hpp"
+#include "TimeStretch.hpp"
+
+// Sample rate of the default audio output
+#define NES_AUDIO_SAMPLE_RATE 44100
+
+// Largest OpenAL buffer. The samples buffered ahead aim for two blocks on top
+// of a frame and the time-stretch input, which has to stay well within
+// APU_SAMPLE_BUFFER_SIZE.
+#define NES_AUDIO_MAX_BLOCKS 64
+#define NES_AUDIO_MAX_BLOCK_SIZE 2048
 
 enum class NesButton {
     Right = 0,
@@ -25,35 +43,169 @@ enum class NesButton {
     A
 };
 
+// How the PPU is kept in step with the CPU
+enum class PpuSyncMode {
+    // PPU ticks on every cycle, interleaved with the CPU. This is the
+    // reference model.
+    Lockstep,
+    // PPU cycles are only owed and caught up at once when the CPU touches
+    // the PPU, during OAM DMA, at VBlank NMI and at the end of the frame.
+    // PPUSTATUS reads are answered from predictions whenever possible.
+    Lazy,
+};
+
+// How fast emulation runs compared to a real NES
+enum class EmulationSpeed {
+    Normal,
+    Turbo2x,
+    Turbo4x,
+    Turbo8x,
+    // As fast as the host can go
+    Unlimited,
+    // Half speed
+    SlowMotion,
+};
+
 class Nes {
 public:
     Nes();
     ~Nes();
 
-    void load(std::string fileName);
+    /// @return false if the ROM could not be loaded, the Nes can not run then
+    bool load(std::string fileName);
+
+    /// Where the audio goes, set before load(). Without one, load() plays it
+    /// through OpenAL.
+    void setAudioSink(std::shared_ptr<IAudioSink> sink) { _audioSink = std::move(sink); }
+
+    /// OpenAL latency: number of blocks queued to the audio device and
+    /// samples per block, clamped to NES_AUDIO_MAX_BLOCKS and
+    /// NES_AUDIO_MAX_BLOCK_SIZE. Set before load().
+    void setAudioBuffer(uint32_t numBlocks, uint32_t blockSize);
     void reset();
     void renderFrame();
+
+    /// Run renderFrame() continuously on an emulation thread of its own,
+    /// paced by getFramePacer()
+    void start();
+    void stop();
+    bool isRunning() const { return _isRunning; }
+    FramePacer& getFramePacer() { return _framePacer; }
+
+    /// Audio buffer fill and rate control, empty before load()
+    ApuStats getAudioStats() const { return _apu ? _apu->getStats() : ApuStats{}; }
+
+    /// Cost of keeping the pitch away from normal speed, empty before load()
+    /// and when the audio is not played in real time
+    TimeStretchStats getTimeStretchStats() const { return _timeStretch ? _timeStretch->getStats() : TimeStretchStats{}; }
+
+    /// Fast forward and slow motion. Above normal speed, only about 60 frames
+    /// per second are handed to the display. Audio played in real time keeps
+    /// its pitch from half to 4x speed, and is muted beyond. Audio that is not
+    /// played in real time, e.g. recorded, is never muted.
+    void setSpeed(EmulationSpeed speed);
+    EmulationSpeed getSpeed() const { return _speed; }
+
+    /// Whether frames not handed to the display skip pixel output altogether
+    void setTurboSkipsPixels(bool skip) { _turboSkipsPixels = skip; }
+
+    /// Pick up the newest completed frame, from any thread but only one
+    /// @return false if no frame was completed since the last call
+    bool updateFrame();
+
+    /// Frame picked up by the last updateFrame()
     uint8_t* getFrameBuffer();
+    const PpuFrame& getFrame() const;
+    void convertFrame(PixelFormat format, uint8_t* output) const;
+    void convertFrame(PixelFormat format, uint8_t* output, uint32_t firstLine, uint32_t numLines) const;
+
+    /// Debug views of the PPU memory. While enabled, they are brought
+    /// up-to-date on the thread running renderFrame() after every frame
+    /// handed to the display, and handed over like frames. Enable, pick up
+    /// and read them from one thread, the one that picks up frames.
+    void setDebugViewsEnabled(bool enabled);
+    void setDebugPatternTablePalette(uint8_t paletteIndex) { _debugPatternTablePalette = paletteIndex; }
+
+    /// Pick up the newest debug views
+    /// @return false if no views were updated since the last call
+    bool updateDebugViews();
+
+    /// Views picked up by the last updateDebugViews() that returned true
+    const PpuDebugViews& getDebugViews() const { return _debugViews->getReadBuffer(); }
+
     void setControllerKey(uint8_t id, NesButton button, bool state);
+
+    /// Any thread, takes effect at the start of the next frame on the thread
+    /// running renderFrame()
+    void setPpuSyncMode(PpuSyncMode mode) { _requestedPpuSyncMode = mode; }
+    PpuSyncMode getPpuSyncMode() const { return _requestedPpuSyncMode; }
+
+    /// Where the APU channels run, set before load()
+    void setApuSyncMode(ApuSyncMode mode) { _apuSyncMode = mode; }
+    ApuSyncMode getApuSyncMode() const { return _apuSyncMode; }
     uint32_t getWidth() const { return PPU_FRAME_WIDTH; };
     uint32_t getHeight() const { return PPU_FRAME_HEIGHT; };
     const char* getName() const { return _fileName.c_str(); };
 
 private:
+    void _renderFrameLockstep();
+    void _renderFrameLazy();
+    void _syncPpu();
+    bool _isFrameShown();
+    void _setupAudio();
+    void _updateAudioSpeed();
+
     std::string _fileName;
 
     std::shared_ptr<Controller> _controller;
     std::shared_ptr<IMemory> _cpuRam;
-    std::shared_ptr<IDevice> _cpuBus;
-    std::shared_ptr<IMemory> _nameTable;
+    std::shared_ptr<CpuBus> _cpuBus;
+    std::shared_ptr<NameTable> _nameTable;
     std::shared_ptr<IMemory> _paletteTable;
     std::shared_ptr<IDevice> _ppuBus;
 
     std::shared_ptr<Cartridge> _cartridge;
-    std::shared_ptr<AudioHw> _audioHw;
+    std::shared_ptr<IAudioSink> _audioSink;
+    std::shared_ptr<TimeStretch> _timeStretch;
     std::shared_ptr<Apu> _apu;
     std::shared_ptr<Ppu> _ppu;
     std::shared_ptr<Cpu> _cpu;
 
+    ApuSyncMode _apuSyncMode{ApuSyncMode::Immediate};
+
+    // OpenAL output blocks
+    uint32_t _audioNumBlocks{8};
+    uint32_t _audioBlockSize{512};
+
     uint8_t _counter{0x00};
+
+    // Lazy PPU synchronization
+    PpuSyncMode _ppuSyncMode{PpuSyncMode::Lazy};
+    std::atomic<PpuSyncMode> _requestedPpuSyncMode{PpuSyncMode::Lazy};
+    uint32_t _ppuPendingCycles{0};
+    uint32_t _ppuCyclesToEvent{0};
+
+    // Completed frames, handed from the emulation to the display
+    TripleBuffer<PpuFrame> _frames;
+
+    // PPU debug views, handed over like the frames. Only allocated once
+    // enabled, and kept from then on since the emulation may be using them.
+    std::atomic<bool> _isDebugViewsEnabled{false};
+    std::atomic<uint8_t> _debugPatternTablePalette{0};
+    std::unique_ptr<TripleBuffer<PpuDebugViews>> _debugViews;
+
+    // RGB conversion of the palette-indexed PPU frame
+    FrameConverter _frameConverter;
+    std::vector<uint8_t> _frameBufferRGB;
+
+    // Fast forward
+    std::atomic<EmulationSpeed> _speed{EmulationSpeed::Normal};
+    std::atomic<bool> _turboSkipsPixels{true};
+    uint32_t _turboFrameCount{0};
+    std::chrono::steady_clock::time_point _lastShownTime;
+
+    // Emulation thread
+    FramePacer _framePacer;
+    std::atomic<bool> _isRunning{false};
+    std::unique_ptr<std::thread> _emulationThread;
 };
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "IAudioSink.hpp"
+
+// Discards all audio. The APU does not even produce samples for it, so
+// running without audio costs nothing.
+class NullAudioSink : public IAudioSink {
+public:
+    NullAudioSink(uint32_t sampleRate = 44100)
+    : _sampleRate{sampleRate}
+    {
+    }
+
+    /// @name Implementation IAudioSink
+    /// @[
+    uint32_t getSampleRate() const { return _sampleRate; }
+    uint32_t getBlockSize() const { return 0; }
+    bool isRealTime() const { return false; }
+    bool isDiscarding() const { return true; }
+    void setReadSamplesCallback(std::function<uint32_t(float*, uint32_t)>) {}
+    bool start() { return true; }
+    void setMuted(bool) {}
+    /// @]
+
+private:
+    uint32_t _sampleRate{0};
+};
@@ -1,8 +1,13 @@
 #include <string.h>
 #include <algorithm>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
 #include "Ppu.hpp"
 #include "PpuBus.hpp"
+#include "PpuDebug.hpp"
 
 constexpr uint8_t resetStackOffset = 0xFD;
 constexpr uint16_t stackBaseAddress = 0x0100;
@@ -11,29 +16,30 @@ constexpr uint16_t resetInterruptAddress = 0xFFFC;
 constexpr uint16_t breakInterruptAddress = 0xFFFE;
 constexpr auto ppuBaseAddress = 0x2000;
 
+// Sprite line buffer entry layout
+constexpr uint8_t spriteLinePixelMask = 0x03;
+constexpr uint8_t spriteLinePaletteShift = 2;
+constexpr uint8_t spriteLinePaletteMask = 0x0C;
+constexpr uint8_t spriteLineBehindBackground = 0x10;
+constexpr uint8_t spriteLineSpriteZero = 0x20;
+
+// Frame timing, positions are counted in cycles from the start of a frame
+constexpr uint32_t cyclesPerScanLine = 341;
+constexpr uint32_t scanLinesPerFrame = 262;
+constexpr uint32_t vBlankSetPosition = 241 * cyclesPerScanLine + 1;
+constexpr uint32_t preRenderClearPosition = 261 * cyclesPerScanLine + 1;
+constexpr uint32_t frameEndPosition = scanLinesPerFrame * cyclesPerScanLine - 1;
+constexpr uint32_t spriteEvaluationCycle = 65;
+constexpr uint32_t spriteZeroPredictionCycle = 320;
+constexpr uint32_t noSpriteZeroHit = UINT32_MAX;
+
 Ppu::Ppu(std::shared_ptr<IDevice> bus, std::shared_ptr<Cartridge> cartridge)
 : _bus{bus}
 , _cartridge{cartridge}
 {
-    // NTSC Palette Table: wiki.nesdev.com/w/index.php/PPU_palettes
-    _paletteTablePixel = {
-        {0x54, 0x54, 0x54}, {0x00, 0x1E, 0x74}, {0x08, 0x10, 0x90}, {0x30, 0x00, 0x88},
-        {0x44, 0x00, 0x64}, {0x5C, 0x00, 0x30}, {0x54, 0x04, 0x00}, {0x3C, 0x18, 0x00},
-        {0x20, 0x2A, 0x00}, {0x08, 0x3A, 0x00}, {0x00, 0x40, 0x00}, {0x00, 0x3C, 0x00},
-        {0x00, 0x32, 0x3C}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
-        {0x98, 0x96, 0x98}, {0x08, 0x4C, 0xC4}, {0x30, 0x32, 0xEC}, {0x5C, 0x1E, 0xE4},
-        {0x88, 0x14, 0xB0}, {0xA0, 0x14, 0x64}, {0x98, 0x22, 0x20}, {0x78, 0x3C, 0x00},
-        {0x54, 0x5A, 0x00}, {0x28, 0x72, 0x00}, {0x08, 0x7C, 0x00}, {0x00, 0x76, 0x28},
-        {0x00, 0x66, 0x78}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
-        {0xEC, 0xEE, 0xEC}, {0x4C, 0x9A, 0xEC}, {0x78, 0x7C, 0xEC}, {0xB0, 0x62, 0xEC},
-        {0xE4, 0x54, 0xEC}, {0xEC, 0x58, 0xB4}, {0xEC, 0x6A, 0x64}, {0xD4, 0x88, 0x20},
-        {0xA0, 0xAA, 0x00}, {0x74, 0xC4, 0x00}, {0x4C, 0xD0, 0x20}, {0x38, 0xCC, 0x6C},
-        {0x38, 0xB4, 0xCC}, {0x3C, 0x3C, 0x3C}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
-        {0xEC, 0xEE, 0xEC}, {0xA8, 0xCC, 0xEC}, {0xBC, 0xBC, 0xEC}, {0xD4, 0xB2, 0xEC},
-        {0xEC, 0xAE, 0xEC}, {0xEC, 0xAE, 0xD4}, {0xEC, 0xB4, 0xB0}, {0xE4, 0xC4, 0x90},
-        {0xCC, 0xD2, 0x78}, {0xB4, 0xDE, 0x78}, {0xA8, 0xE2, 0x90}, {0x98, 0xE2, 0xB4},
-        {0xA0, 0xD6, 0xE4}, {0xA0, 0xA2, 0xA0}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
-    };
+#if defined(__x86_64__) || defined(__i386__)
+    _hasAVX2 = __builtin_cpu_supports("avx2");
+#endif
 }
 
 Ppu::~Ppu() {}
@@ -102,6 +108,10 @@ bool Ppu::write(uint16_t address, uint8_t data)
     // PPU Address mirrored every 8 bytes
     localAddress = localAddress & 0x7;
 
+    // Any register write may change scroll, pattern or mask used to predict
+    // the sprite zero hit
+    _spriteZeroPredicted = false;
+
     switch (static_cast<PpuRegisterAddress>(localAddress)) {
     case PpuRegisterAddress::Control:
         registers.control = data;
@@ -168,6 +178,12 @@ bool Ppu::write(uint16_t address, uint8_t data)
     } break;
     case PpuRegisterAddress::VRAMData:
         _bus->write(registers.currVramAddress, data);
+        if (registers.currVramAddress >= paletteTableBaseAddress) {
+            _updatePaletteColor(registers.currVramAddress);
+        } else if (_debug) {
+            // Let the debug views know which tile to redraw
+            _debug->onVramWrite(registers.currVramAddress);
+        }
 
         // Auto increment VRAM address when writing to data
         // The increment step depends on the PPU control register
@@ -203,76 +219,82 @@ void Ppu::tick()
 
         // Visible scanlines (0-239) and
         // Pre-render (dummy) scanline (261)
-        switch (_cycles) {
-        case 1 ... 256:
-        case 321 ... 336:
-        {
-            // Move our shift registers by 1-bit in the visible scanlines
-            _moveShiftRegisters();
-
-            // The data for each tile is fetched during this phase. Each memory
-            // access takes 2 PPU cycles to complete, and 4 must be performed per tile:
-            //   1. Nametable byte
-            //   2. Attribute table byte
-            //   3. Pattern table tile low
-            //   4. Pattern table tile high (+8 bytes from pattern table tile low)
-            switch ((_cycles - 1) % 8) {
-            case 0:
-                // Load pattern and attribute to our shift registers
-                _loadShiftRegisters();
-
-                // NT byte
-                nextNameTableByte = _getNextNameTableByte();
-                break;
-            case 2:
-                // AT byte
-                nextAttributeByte = _getNextAttributeByte();
-                break;
-            case 4:
-                // Low BG tile byte
-                nextLowBGTileByte = _getBackgroundTileByte(false /*LSB*/);
+        // No memory is fetched while background and sprites are both disabled
+        if (_isRenderingEnabled()) {
+            switch (_cycles) {
+            case 1 ... 256:
+            case 321 ... 336:
+            {
+                // Move our shift registers by 1-bit in the visible scanlines
+                _moveShiftRegisters();
+
+                // The data for each tile is fetched during this phase. Each memory
+                // access takes 2 PPU cycles to complete, and 4 must be performed per tile:
+                //   1. Nametable byte
+                //   2. Attribute table byte
+                //   3. Pattern table tile low
+                //   4. Pattern table tile high (+8 bytes from pattern table tile low)
+                switch ((_cycles - 1) % 8) {
+                case 0:
+                    // Load pattern and attribute to our shift registers
+                    _loadShiftRegisters();
+
+                    // NT byte
+                    nextNameTableByte = _getNextNameTableByte();
+                    break;
+                case 2:
+                    // AT byte
+                    nextAttributeByte = _getNextAttributeByte();
+                    break;
+                case 4:
+                    // Low BG tile byte
+                    nextLowBGTileByte = _getBackgroundTileByte(false /*LSB*/);
+                    break;
+                case 6:
+                    // High BG tile byte
+                    nextHighBGTileByte = _getBackgroundTileByte(true /*MSB*/);
+                    break;
+                case 7:
+                    // Increment horizontal current VRAM
+                    _incrementVramHorizontalInfo();
+                    break;
+                default:
+                    break;
+                }
+
+                if (_cycles == 256) {
+                    // Increment vertical current VRAM
+                    _incrementVramVerticalInfo();
+                }
                 break;
-            case 6:
-                // High BG tile byte
-                nextHighBGTileByte = _getBackgroundTileByte(true /*MSB*/);
+            }
+            case 257 ... 320:
+            {
+                if (_cycles == 257) {
+                    // Load pattern and attribute to our shift registers
+                    _loadShiftRegisters();
+
+                    // Copy horizontal temporary VRAM to current VRAM
+                    _updateVramHorizontalInfo();
+                } else if (_cycles == spriteZeroPredictionCycle) {
+                    // Sprites and scroll of the next scanline are known now
+                    _predictSpriteZeroHit();
+                }
                 break;
-            case 7:
-                // Increment horizontal current VRAM
-                _incrementVramHorizontalInfo();
+            }
+            case 337 ... 340:
+            {
+                // Two Nametable bytes are fetched, but the purpose for this is unknown.
+                if ((_cycles == 337) || (_cycles == 339)) {
+                    // NT byte
+                    auto tile = registers.currVramAddress & 0x0FFF;
+                    _bus->read(nameTableBaseAddress + tile, nextNameTableByte);
+                }
                 break;
+            }
             default:
                 break;
             }
-
-            if (_cycles == 256) {
-                // Increment vertical current VRAM
-                _incrementVramVerticalInfo();
-            }
-            break;
-        }
-        case 257 ... 320:
-        {
-            if (_cycles == 257) {
-                // Load pattern and attribute to our shift registers
-                _loadShiftRegisters();
-
-                // Copy horizontal temporary VRAM to current VRAM
-                _updateVramHorizontalInfo();
-            }
-            break;
-        }
-        case 337 ... 340:
-        {
-            // Two Nametable bytes are fetched, but the purpose for this is unknown.
-            if ((_cycles == 337) || (_cycles == 339)) {
-                // NT byte
-                auto tile = registers.currVramAddress & 0x0FFF;
-                _bus->read(nameTableBaseAddress + tile, nextNameTableByte);
-            }
-            break;
-        }
-        default:
-            break;
         }
 
         if (_scanLine == 261) {
@@ -290,7 +312,7 @@ void Ppu::tick()
                 // Copy vertical temporary VRAM to current VRAM
                 _updateVramVerticalInfo();
             }
-        } else {
+        } else if (_isRenderingEnabled()) {
             // Events for visible scanlines only
             // These are foreground related evaluation
             switch (_cycles) {
@@ -299,64 +321,15 @@ void Ppu::tick()
                 clearSecondaryOAMData(0xFF);
                 break;
             case 65:
-            {
                 // Sprite Evaluation Logic
-                _spriteZeroNextScanLine = false;
-                uint8_t index = 0;
-                for (uint8_t secondaryIndex = 0; index < PPU_MAX_SPRITES; index++) {
-                    _spritesSecondary[secondaryIndex].positionY = _sprites[index].positionY;
-                    uint8_t spriteHeight = _spritesSecondary[secondaryIndex].positionY + 8;
-                    if (registers.controlFlag.spriteSize) {
-                        // sprite's height is 16 pixel high
-                        spriteHeight += 8;
-                    }
-                    // Check if this sprite can be seen on this scanline
-                    if ((_scanLine >= _spritesSecondary[secondaryIndex].positionY) &&
-                        (_scanLine < spriteHeight)) {
-                        memcpy(&_spritesSecondary[secondaryIndex], &_sprites[index], sizeof(SpriteInformation));
-                        secondaryIndex++;
-                        if (index == 0) {
-                            _spriteZeroNextScanLine = true;
-                        }
-                    }
-                    if (secondaryIndex >= PPU_MAX_SPRITES_SECONDARY) {
-                        // We've filled up our Secondary OAM buffer, stop
-                        // evaluating sprites from Primary OAM buffer.
-                        break;
-                    }
-                }
-
-                // Sprite Overflow Detection: Emulate hardware bug
-                // Check the remaining Primary OAM buffer, but in a weird way.
-                // Get to the next primary OAM index after evaluating
-                index++;
-                uint8_t* OAMData = reinterpret_cast<uint8_t*>(_sprites);
-                uint8_t infoIndex = 0;
-                for (; index < PPU_MAX_SPRITES; index++) {
-                    // This is the bug: infoIndex should've remained 0 while
-                    // searching for a sprite overflow, but what happened is
-                    // that this index got always incremented, so we're now
-                    // checking for the wrong data as positionY, thus could led
-                    // to false positives and negatives.
-                    uint8_t positionY = OAMData[index * 4 + infoIndex];
-                    uint8_t spriteHeight = positionY + 8;
-                    if (registers.controlFlag.spriteSize) {
-                        // sprite's height is 16 pixel high
-                        spriteHeight += 8;
-                    }
-                    // Check if this sprite can be seen on this scanline
-                    if ((_scanLine >= positionY) && (_scanLine < spriteHeight)) {
-                        // Set Sprite Overflow flag
-                        registers.statusFlag.spriteOverflow = true;
-                        break;
-                    }
-                    infoIndex++;
-                    if (infoIndex >= 4) {
-                        infoIndex = 0;
-                    }
+#if defined(__x86_64__) || defined(__i386__)
+                if (_hasAVX2) {
+                    _evaluateSpritesAVX2();
+                    break;
                 }
+#endif
+                _evaluateSprites();
                 break;
-            }
             case 257 ... 320:
             {
                 if (_cycles == 257) {
@@ -448,6 +421,11 @@ void Ppu::tick()
                 default:
                     break;
                 }
+
+                if ((_cycles == 320) && (_spriteRenderMode == SpriteRenderMode::LineBuffer)) {
+                    // All sprites for the next scanline are fetched
+                    _rasterizeSpriteLine();
+                }
                 break;
             }
             default:
@@ -482,12 +460,32 @@ void Ppu::tick()
         (_cycles >= 1) && (_cycles <= 256)) {
         auto pixelIndex = uint8_t{0x00};
         auto paletteIndex = uint8_t{0x00};
-        _getIndexFromShiftRegisters(pixelIndex, paletteIndex);
+        if (_isPixelOutputEnabled) {
+            _getIndexFromShiftRegisters(pixelIndex, paletteIndex);
 
-        Pixel myPixel = _getPixelPaletteTable(pixelIndex, paletteIndex);
-        _frameBufferRGB[_bufferPixelIndex++] = myPixel.red;
-        _frameBufferRGB[_bufferPixelIndex++] = myPixel.green;
-        _frameBufferRGB[_bufferPixelIndex++] = myPixel.blue;
+            auto color = getPaletteColor(pixelIndex, paletteIndex);
+            if (registers.maskFlag.greyScale) {
+                // Greyscale only keeps the brightness column of the palette
+                color &= 0x30;
+            }
+
+            if (_cycles == 1) {
+                _startFrameLine(_scanLine);
+            }
+
+            // Compare with the previous frame on the way, it is still in here
+            _frame.dirtyLines[_scanLine] |= (_frame.pixels[_bufferPixelIndex] != color);
+            _frame.pixels[_bufferPixelIndex++] = color;
+        } else {
+            // Only sprite zero hit is left to find out. Sprite shift registers
+            // are stepped by every lookup, the line buffer lookup can be
+            // skipped unless sprite zero is on this scanline.
+            if ((_spriteRenderMode == SpriteRenderMode::ShiftRegisters) ||
+                (_spriteZeroOnScanLine && !registers.statusFlag.spriteZeroHit)) {
+                _getIndexFromShiftRegisters(pixelIndex, paletteIndex);
+            }
+            _bufferPixelIndex++;
+        }
     }
 
     // Increment cycles and scanlines based on PPU rendering
@@ -499,13 +497,256 @@ void Ppu::tick()
             _scanLine = 0;
             _bufferPixelIndex = 0;
             _frameDone = true;
+            if (_isPixelOutputEnabled) {
+                _frame.sequence++;
+            }
+            _spriteZeroPredicted = false;
+        }
+    }
+}
+
+void Ppu::_startFrameLine(uint32_t scanLine)
+{
+    // Latch the color emphasis bits, a change redraws the whole line
+    auto emphasis = static_cast<uint8_t>(registers.mask >> 5);
+    _frame.dirtyLines[scanLine] = (_frame.emphasis[scanLine] != emphasis);
+    _frame.emphasis[scanLine] = emphasis;
+}
+
+uint32_t Ppu::advance(uint32_t cycles)
+{
+    auto executed = uint32_t{0};
+    while (executed < cycles) {
+        auto idleCycles = std::min(_getIdleCycles(), cycles - executed);
+        if (idleCycles > 0) {
+            _skipIdleCycles(idleCycles);
+            executed += idleCycles;
+            continue;
         }
+
+        tick();
+        executed++;
+        if (_vBlank || _frameDone) {
+            // Let the caller service the NMI or the finished frame
+            break;
+        }
+    }
+
+    return executed;
+}
+
+uint32_t Ppu::getCyclesToNextEvent() const
+{
+    auto position = _scanLine * cyclesPerScanLine + _cycles;
+
+    if (position == 0) {
+        // The skip cycle makes the first tick() cover two cycles
+        return vBlankSetPosition;
+    } else if (position <= vBlankSetPosition) {
+        return vBlankSetPosition - position + 1;
     }
+    return frameEndPosition - position + 1;
+}
+
+bool Ppu::readStatusAhead(uint32_t cycles, uint8_t& data)
+{
+    // Window of cycles the PPU still has to run before the read
+    auto first = _scanLine * cyclesPerScanLine + _cycles;
+    auto last = first + cycles - 1;
+    if (first == 0) {
+        // The skip cycle makes the first tick() cover two cycles
+        last++;
+    }
+
+    auto status = registers.status;
+    if (cycles > 0) {
+        // VBlank flag set or flags clear in between
+        if (((first <= vBlankSetPosition) && (vBlankSetPosition <= last)) ||
+            ((first <= preRenderClearPosition) && (preRenderClearPosition <= last))) {
+            return false;
+        }
+
+        // Sprite evaluation in between could set the Sprite Overflow flag
+        if (!registers.statusFlag.spriteOverflow && _isRenderingEnabled()) {
+            auto scanLine = first / cyclesPerScanLine;
+            if ((first % cyclesPerScanLine) > spriteEvaluationCycle) {
+                scanLine++;
+            }
+            if ((scanLine < PPU_FRAME_HEIGHT) && (scanLine * cyclesPerScanLine + spriteEvaluationCycle <= last)) {
+                return false;
+            }
+        }
+
+        // Sprite Zero Hit only changes when both layers are shown
+        if (!registers.statusFlag.spriteZeroHit && registers.maskFlag.showBackground &&
+            registers.maskFlag.showSprites) {
+            if (!_spriteZeroPredicted || (last > _spriteZeroPredictionEnd)) {
+                return false;
+            }
+            if (_spriteZeroHitPosition <= last) {
+                status |= 0x40;
+            }
+        }
+    }
+
+    // Same as a PPUSTATUS read, the flags we clear cannot change in between
+    data = (status & 0xE0) | (registers.tempVramData & 0x1F);
+    registers.statusFlag.verticalBlankFlag = false;
+    registers.vramAddressLatch = false;
+    return true;
+}
+
+void Ppu::_predictSpriteZeroHit()
+{
+    auto nextScanLine = (_scanLine == 261) ? 0 : _scanLine + 1;
+
+    // The prediction holds until the next one, scanlines 240-261 show no pixels
+    _spriteZeroPredicted = true;
+    _spriteZeroHitPosition = noSpriteZeroHit;
+    if (nextScanLine >= PPU_FRAME_HEIGHT) {
+        _spriteZeroPredictionEnd = 261 * cyclesPerScanLine + spriteZeroPredictionCycle;
+        return;
+    }
+    _spriteZeroPredictionEnd = nextScanLine * cyclesPerScanLine + spriteZeroPredictionCycle;
+
+    if (!_spriteZeroOnScanLine || !registers.maskFlag.showBackground || !registers.maskFlag.showSprites) {
+        return;
+    }
+
+    // Sprite Zero Hit does not happen at first 8 pixels if the left-side
+    // clipping window is enabled
+    auto firstX = int16_t{0};
+    if (!registers.maskFlag.showBackgroundLeft || !registers.maskFlag.showSpritesLeft) {
+        firstX = 8;
+    }
+
+    // Sprite zero always sits in slot 0 and is drawn on top of the other
+    // sprites, a sprite at X starts shifting out its pattern at pixel X-1
+    auto lowTile = shiftRegisterLowSpriteTile[0];
+    auto highTile = shiftRegisterHighSpriteTile[0];
+    for (int16_t column = 0; column < 8; column++) {
+        auto x = static_cast<int16_t>(_spritePositionX[0]) - 1 + column;
+        if ((x < firstX) || (x >= PPU_FRAME_WIDTH)) {
+            continue;
+        }
+        if ((((lowTile | highTile) >> (7 - column)) & 0x01) && _isBackgroundOpaque(x)) {
+            // Pixel x is drawn on cycle x + 1
+            _spriteZeroHitPosition = nextScanLine * cyclesPerScanLine + x + 1;
+            return;
+        }
+    }
+}
+
+// Whether the background pixel x of the next scanline is opaque, reading the
+// tile the background fetches are going to read for it
+bool Ppu::_isBackgroundOpaque(uint16_t x)
+{
+    auto offset = x + registers.fineXScroll;
+    auto coarseX = registers.currVramFlag.coarseXScroll + offset / 8;
+
+    // Keep NameTable and coarse Y of the current VRAM, only coarse X moves
+    auto tileAddress = registers.currVramAddress & 0x0FE0;
+    if (coarseX >= 32) {
+        // Wrapped around into the other horizontal NameTable
+        tileAddress ^= 0x0400;
+    }
+    tileAddress |= coarseX & 0x1F;
+
+    auto tile = uint8_t{0x00};
+    _bus->read(nameTableBaseAddress + tileAddress, tile);
+
+    auto patternAddress = uint16_t{0x0000};
+    if (registers.controlFlag.backgroundPatternTable) {
+        patternAddress = patternTableBackgroundAddress;
+    } else {
+        patternAddress = patternTableSpriteAddress;
+    }
+    patternAddress += tile * 16 + registers.currVramFlag.fineYScroll;
+
+    auto lowByte = uint8_t{0x00};
+    auto highByte = uint8_t{0x00};
+    _bus->read(patternAddress, lowByte);
+    _bus->read(patternAddress + 8, highByte);
+    return ((lowByte | highByte) >> (7 - (offset % 8))) & 0x01;
+}
+
+// Number of cycles from the current position during which tick() would do
+// nothing but write backdrop pixels and count cycles
+uint32_t Ppu::_getIdleCycles() const
+{
+    auto position = _scanLine * cyclesPerScanLine + _cycles;
+
+    if (_isRenderingEnabled()) {
+        // Only the post-render and vertical blanking lines are idle, up to the
+        // pre-render scanline flag clear
+        if ((position < 240 * cyclesPerScanLine) || (position >= preRenderClearPosition)) {
+            return 0;
+        }
+    } else if ((position == 0) || (position >= frameEndPosition)) {
+        // The skip cycle and the end of frame are handled by tick()
+        return 0;
+    }
+
+    if (position <= vBlankSetPosition) {
+        return vBlankSetPosition - position;
+    } else if (position <= preRenderClearPosition) {
+        return preRenderClearPosition - position;
+    }
+    return frameEndPosition - position;
+}
+
+void Ppu::_skipIdleCycles(uint32_t cycles)
+{
+    auto position = _scanLine * cyclesPerScanLine + _cycles;
+    auto endPosition = position + cycles;
+
+    // Visible cycles only show the backdrop color while rendering is disabled
+    auto color = _paletteColors[0];
+    if (registers.maskFlag.greyScale) {
+        color &= 0x30;
+    }
+    for (uint32_t scanLine = _scanLine; scanLine < PPU_FRAME_HEIGHT; scanLine++) {
+        auto lineStart = scanLine * cyclesPerScanLine;
+        auto first = std::max(position, lineStart + 1);
+        auto last = std::min(endPosition, lineStart + PPU_FRAME_WIDTH + 1);
+        if (first >= endPosition) {
+            break;
+        }
+        if (first >= last) {
+            continue;
+        }
+
+        // Frames nobody is going to see keep the pixels of the last shown
+        // one, so that its dirty lines stay right for the next shown frame
+        if (!_isPixelOutputEnabled) {
+            _bufferPixelIndex += last - first;
+            continue;
+        }
+
+        if (first == lineStart + 1) {
+            _startFrameLine(scanLine);
+        }
+        auto pixels = &_frame.pixels[_bufferPixelIndex];
+        for (uint32_t x = 0; x < last - first; x++) {
+            _frame.dirtyLines[scanLine] |= (pixels[x] != color);
+        }
+        memset(pixels, color, last - first);
+        _bufferPixelIndex += last - first;
+    }
+
+    _scanLine = endPosition / cyclesPerScanLine;
+    _cycles = endPosition % cyclesPerScanLine;
 }
 
 void Ppu::reset()
 {
     memset(&registers, 0, sizeof(PpuRegister));
+    memset(&_frame, 0, sizeof(PpuFrame));
+
+    // Resolve the whole palette RAM once, palette writes keep it up-to-date
+    for (uint16_t address = 0; address < PPU_PALETTE_SIZE; address++) {
+        _updatePaletteColor(paletteTableBaseAddress + address);
+    }
 
     // PPU background rendering
     nextNameTableByte = 0x00;
@@ -528,6 +769,8 @@ void Ppu::reset()
     memset(&shiftRegisterHighSpriteTile, 0, sizeof(shiftRegisterHighSpriteTile));
     memset(&_spriteAttribute, 0, sizeof(_spriteAttribute));
     memset(&_spritePositionX, 0, sizeof(_spritePositionX));
+    memset(&_spriteLine, 0, sizeof(_spriteLine));
+    _spriteZeroPredicted = false;
 }
 
 bool Ppu::isVBlankTriggered()
@@ -552,127 +795,29 @@ bool Ppu::isFrameDone()
     return frameDone;
 }
 
-uint8_t* Ppu::getFrameBuffer()
-{
-    // Temporary static noise
-    /*for (uint32_t pixel = 0; pixel < PPU_FRAME_BUFFER_RGB_SIZE;) {
-        uint8_t value = rand() % 255;
-        _frameBufferRGB[pixel++] = value;
-        _frameBufferRGB[pixel++] = value;
-        _frameBufferRGB[pixel++] = value;
-    }*/
-
-    /*
-    // Getting PatternTable #0
-    auto pattern = _getPatternTableTile(0, 1);
-    uint16_t pixel = 0;
-    for (int a = 0; a < 16; a++) {
-        for (int j = 0; j < 8; j++) {
-            for (int i = a * 16; i < (a+1)*16; i++) {
-                for (int k = j * 8; k < (j+1)*8; k++) {
-                    Pixel myPixel = pattern.tile[i].pixel[k];
-                    _frameBufferRGB[pixel++] = myPixel.red;
-                    _frameBufferRGB[pixel++] = myPixel.green;
-                    _frameBufferRGB[pixel++] = myPixel.blue;
-                }
-            }
-        }
-    }*/
-
-    /*
-    // Getting NameTable #0
-    auto nameTable = _getNameTableTile(0);
-    uint32_t pixel = 0;
-    for (int a = 0; a < 30; a++) {
-        for (int j = 0; j < 8; j++) {
-            for (int i = a * 32; i < (a + 1) * 32; i++) {
-                for (int k = j * 8; k < (j + 1) * 8; k++) {
-                    Pixel myPixel = nameTable.tile[i].pixel[k];
-                    _frameBufferRGB[pixel++] = myPixel.red;
-                    _frameBufferRGB[pixel++] = myPixel.green;
-                    _frameBufferRGB[pixel++] = myPixel.blue;
-                }
-            }
-        }
-    }*/
-
-    return _frameBufferRGB;
-}
-
-NameTableTile Ppu::_getNameTableTile(uint8_t index)
+PpuDebug& Ppu::getDebug()
 {
-    auto nameTableAddress = uint16_t{0x0000};
-    switch (index) {
-    case 0:
-        nameTableAddress = nameTable1StartAddress;
-        break;
-    case 1:
-        nameTableAddress = nameTable2StartAddress;
-        break;
-    case 2:
-        nameTableAddress = nameTable3StartAddress;
-        break;
-    case 3:
-        nameTableAddress = nameTable4StartAddress;
-        break;
-    default:
-        break;
+    if (!_debug) {
+        _debug = std::make_unique<PpuDebug>(*this, _bus, _cartridge);
     }
-
-    // Temporarily get pattern #0 using palette #0
-    auto pattern = _getPatternTableTile(1, 1);
-
-    // Let's access the name table: 32x30 tiles
-    for (uint16_t tile = 0; tile < 32 * 30; tile++) {
-        auto patternIndex = uint8_t{0x00};
-        _bus->read(nameTableAddress + tile, patternIndex);
-
-        // Copy this Pattern to our Name Table
-        _nameTablePixel[index].tile[tile] = pattern.tile[patternIndex];
-    }
-
-    return _nameTablePixel[index];
+    return *_debug;
 }
 
-PatternTableTile Ppu::_getPatternTableTile(uint8_t type, uint8_t paletteIndex)
+uint8_t Ppu::getPaletteColor(uint8_t pixelIndex, uint8_t paletteIndex) const
 {
-    auto patternAddress = uint16_t{0x0000};
-    if (type == 0) {
-        patternAddress = patternTableSpriteAddress;
-    } else {
-        patternAddress = patternTableBackgroundAddress;
-    }
-
-    // Let's access this pattern: 16x16 tiles
-    for (uint16_t tile = 0; tile < 16 * 16; tile++) {
-        // Let's access this tile: 8x8 pixels
-        for (uint8_t x = 0; x < 8; x++) {
-            auto lowByte = uint8_t{0x00};
-            auto highByte = uint8_t{0x00};
-            _bus->read(patternAddress + tile * 16 + x + 0, lowByte);
-            _bus->read(patternAddress + tile * 16 + x + 8, highByte);
-
-            // The least significant bit goes to the last pixel index, that's
-            // why we count from 7 to 0 index
-            for (uint8_t y = 8; y > 0; y--) {
-                auto pixelIndex = ((highByte & 0x01) << 1) + (lowByte & 0x01);
-                highByte = highByte >> 1;
-                lowByte = lowByte >> 1;
-
-                auto currentPixel = _getPixelPaletteTable(pixelIndex, paletteIndex);
-                _patternTablePixel[type].tile[tile].pixel[x * 8 + (y - 1)] = currentPixel;
-            }
-        }
-    }
-
-    return _patternTablePixel[type];
+    return _paletteColors[(paletteIndex * 4 + pixelIndex) & (PPU_PALETTE_SIZE - 1)];
 }
 
-Pixel Ppu::_getPixelPaletteTable(uint8_t pixelIndex, uint8_t paletteIndex)
+void Ppu::_updatePaletteColor(uint16_t address)
 {
-    auto paletteByte = uint8_t{0x00};
-    _bus->read(paletteTableBaseAddress + paletteIndex * 4 + pixelIndex, paletteByte);
-    return _paletteTablePixel[paletteByte];
+    // Entries 0x10/0x14/0x18/0x1C are mirrors of 0x00/0x04/0x08/0x0C, so
+    // always refresh the entry 16 bytes away as well.
+    auto index = address & (PPU_PALETTE_SIZE - 1);
+    auto mirrorIndex = index ^ 0x10;
+    _bus->read(paletteTableBaseAddress + index, _paletteColors[index]);
+    _bus->read(paletteTableBaseAddress + mirrorIndex, _paletteColors[mirrorIndex]);
+    _paletteColors[index] &= 0x3F;
+    _paletteColors[mirrorIndex] &= 0x3F;
 }
 
 void Ppu::_incrementVramHorizontalInfo()
@@ -867,40 +1012,10 @@ void Ppu::_getIndexFromShiftRegisters(uint8_t& pixelIndex, uint8_t& paletteIndex
 
     if (registers.maskFlag.showSprites) {
         _spriteZeroUsed = false;
-        for (uint8_t i = 0; i < PPU_MAX_SPRITES_SECONDARY; i++) {
-            if (_spritePositionX[i] > 0) {
-                _spritePositionX[i]--;
-            } else {
-                shiftRegisterLowSpriteTile[i] <<= 1;
-                shiftRegisterHighSpriteTile[i] <<= 1;
-            }
-        }
-        for (uint8_t i = 0; i < PPU_MAX_SPRITES_SECONDARY; i++) {
-            if (_spritePositionX[i] == 0) {
-                auto lowBit = uint8_t{0x00};
-                auto highBit = uint8_t{0x00};
-                if (shiftRegisterLowSpriteTile[i] & 0x80) {
-                    lowBit = 0x01;
-                }
-                if (shiftRegisterHighSpriteTile[i] & 0x80) {
-                    highBit = 0x01;
-                }
-                spritePixelIndex = (highBit << 1) + lowBit;
-
-                SpriteAttributeFlags spriteAttribute = *((SpriteAttributeFlags*)&_spriteAttribute[i]);
-                spritePriority = !spriteAttribute.isBehindBackground;
-
-                // Add 0x04 since this is on sprite palette table
-                spritePaletteIndex = spriteAttribute.spritePaletteIndex + 0x04;
-
-                if (spritePixelIndex != 0) {
-                    // Check if SpriteZero is being used
-                    if (i == 0 && _spriteZeroOnScanLine) {
-                        _spriteZeroUsed = true;
-                    }
-                    break;
-                }
-            }
+        if (_spriteRenderMode == SpriteRenderMode::LineBuffer) {
+            _getSpriteFromLineBuffer(spritePixelIndex, spritePaletteIndex, spritePriority);
+        } else {
+            _getSpriteFromShiftRegisters(spritePixelIndex, spritePaletteIndex, spritePriority);
         }
     }
 
@@ -943,15 +1058,246 @@ void Ppu::_getIndexFromShiftRegisters(uint8_t& pixelIndex, uint8_t& paletteIndex
     }
 }
 
+void Ppu::_evaluateSprites()
+{
+    _spriteZeroNextScanLine = false;
+    uint8_t index = 0;
+    for (uint8_t secondaryIndex = 0; index < PPU_MAX_SPRITES; index++) {
+        _spritesSecondary[secondaryIndex].positionY = _sprites[index].positionY;
+        uint8_t spriteHeight = _spritesSecondary[secondaryIndex].positionY + 8;
+        if (registers.controlFlag.spriteSize) {
+            // sprite's height is 16 pixel high
+            spriteHeight += 8;
+        }
+        // Check if this sprite can be seen on this scanline
+        if ((_scanLine >= _spritesSecondary[secondaryIndex].positionY) &&
+            (_scanLine < spriteHeight)) {
+            memcpy(&_spritesSecondary[secondaryIndex], &_sprites[index], sizeof(SpriteInformation));
+            secondaryIndex++;
+            if (index == 0) {
+                _spriteZeroNextScanLine = true;
+            }
+        }
+        if (secondaryIndex >= PPU_MAX_SPRITES_SECONDARY) {
+            // We've filled up our Secondary OAM buffer, stop
+            // evaluating sprites from Primary OAM buffer.
+            break;
+        }
+    }
+
+    // Sprite Overflow Detection: Emulate hardware bug
+    // Check the remaining Primary OAM buffer, but in a weird way.
+    // Get to the next primary OAM index after evaluating
+    index++;
+    uint8_t* OAMData = reinterpret_cast<uint8_t*>(_sprites);
+    uint8_t infoIndex = 0;
+    for (; index < PPU_MAX_SPRITES; index++) {
+        // This is the bug: infoIndex should've remained 0 while
+        // searching for a sprite overflow, but what happened is
+        // that this index got always incremented, so we're now
+        // checking for the wrong data as positionY, thus could led
+        // to false positives and negatives.
+        uint8_t positionY = OAMData[index * 4 + infoIndex];
+        uint8_t spriteHeight = positionY + 8;
+        if (registers.controlFlag.spriteSize) {
+            // sprite's height is 16 pixel high
+            spriteHeight += 8;
+        }
+        // Check if this sprite can be seen on this scanline
+        if ((_scanLine >= positionY) && (_scanLine < spriteHeight)) {
+            // Set Sprite Overflow flag
+            registers.statusFlag.spriteOverflow = true;
+            break;
+        }
+        infoIndex++;
+        if (infoIndex >= 4) {
+            infoIndex = 0;
+        }
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// OAM bytes compared by the sprite overflow hardware bug: sprite k is read at
+// byte offset (k - first) & 3, where first is the first sprite checked. Only
+// first % 4 matters, so there are four masks, each one covering 16 sprites
+// (64 OAM bytes).
+constexpr uint64_t overflowCheckMask(int phase)
+{
+    auto mask = uint64_t{0};
+    for (int sprite = 0; sprite < 16; sprite++) {
+        mask |= uint64_t{1} << (sprite * 4 + ((sprite - phase) & 0x03));
+    }
+    return mask;
+}
+constexpr uint64_t overflowCheckMasks[4] = {
+    overflowCheckMask(0), overflowCheckMask(1), overflowCheckMask(2), overflowCheckMask(3),
+};
+constexpr uint64_t spritePositionYMask = 0x1111111111111111;
+
+__attribute__((target("avx2"))) void Ppu::_evaluateSpritesAVX2()
+{
+    // Same result as _evaluateSprites(), but every byte of the primary OAM is
+    // compared against the scanline at once, then the first eight matching
+    // sprites and the overflow result are picked from the resulting bitmask.
+    const uint8_t* OAMData = reinterpret_cast<uint8_t*>(_sprites);
+    const auto scanLine = _mm256_set1_epi8(static_cast<char>(_scanLine));
+    const auto spriteHeight = _mm256_set1_epi8(registers.controlFlag.spriteSize ? 15 : 7);
+
+    // Bit N is set when OAM byte N, taken as a Y position, is on this scanline
+    uint64_t inRange[4] = {0, 0, 0, 0};
+    for (uint8_t chunk = 0; chunk < 8; chunk++) {
+        auto positionY = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(OAMData + chunk * 32));
+        // positionY <= scanLine
+        auto isAbove = _mm256_cmpeq_epi8(_mm256_max_epu8(positionY, scanLine), scanLine);
+        // (scanLine - positionY) < height
+        auto offset = _mm256_sub_epi8(scanLine, positionY);
+        auto isInside = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, spriteHeight), offset);
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(isAbove, isInside)));
+        inRange[chunk / 2] |= static_cast<uint64_t>(mask) << ((chunk % 2) * 32);
+    }
+
+    _spriteZeroNextScanLine = inRange[0] & 0x01;
+
+    // Copy the first eight visible sprites to the secondary OAM
+    uint8_t secondaryIndex = 0;
+    uint8_t index = PPU_MAX_SPRITES;
+    for (uint8_t word = 0; (word < 4) && (secondaryIndex < PPU_MAX_SPRITES_SECONDARY); word++) {
+        auto sprites = inRange[word] & spritePositionYMask;
+        while (sprites && (secondaryIndex < PPU_MAX_SPRITES_SECONDARY)) {
+            index = word * 16 + __builtin_ctzll(sprites) / 4;
+            memcpy(&_spritesSecondary[secondaryIndex++], &_sprites[index], sizeof(SpriteInformation));
+            sprites &= sprites - 1;
+        }
+    }
+
+    if (secondaryIndex < PPU_MAX_SPRITES_SECONDARY) {
+        // The hardware keeps copying Y positions into the next free slot, so
+        // it ends up with the last sprite's Y unless that one was copied.
+        if (index != PPU_MAX_SPRITES - 1) {
+            _spritesSecondary[secondaryIndex].positionY = _sprites[PPU_MAX_SPRITES - 1].positionY;
+        }
+        return;
+    }
+
+    // Sprite Overflow Detection: Emulate hardware bug, see _evaluateSprites()
+    index++;
+    if (index >= PPU_MAX_SPRITES) {
+        return;
+    }
+    auto checkMask = overflowCheckMasks[index & 0x03];
+    for (uint8_t word = index / 16; word < 4; word++) {
+        auto mask = inRange[word] & checkMask;
+        if (word == index / 16) {
+            // Only sprites after the last one copied
+            mask &= ~uint64_t{0} << ((index % 16) * 4);
+        }
+        if (mask) {
+            registers.statusFlag.spriteOverflow = true;
+            break;
+        }
+    }
+}
+#endif
+
+void Ppu::_getSpriteFromShiftRegisters(uint8_t& pixelIndex, uint8_t& paletteIndex, bool& priority)
+{
+    for (uint8_t i = 0; i < PPU_MAX_SPRITES_SECONDARY; i++) {
+        if (_spritePositionX[i] > 0) {
+            _spritePositionX[i]--;
+        } else {
+            shiftRegisterLowSpriteTile[i] <<= 1;
+            shiftRegisterHighSpriteTile[i] <<= 1;
+        }
+    }
+    for (uint8_t i = 0; i < PPU_MAX_SPRITES_SECONDARY; i++) {
+        if (_spritePositionX[i] == 0) {
+            auto lowBit = uint8_t{0x00};
+            auto highBit = uint8_t{0x00};
+            if (shiftRegisterLowSpriteTile[i] & 0x80) {
+                lowBit = 0x01;
+            }
+            if (shiftRegisterHighSpriteTile[i] & 0x80) {
+                highBit = 0x01;
+            }
+            pixelIndex = (highBit << 1) + lowBit;
+
+            SpriteAttributeFlags spriteAttribute = *((SpriteAttributeFlags*)&_spriteAttribute[i]);
+            priority = !spriteAttribute.isBehindBackground;
+
+            // Add 0x04 since this is on sprite palette table
+            paletteIndex = spriteAttribute.spritePaletteIndex + 0x04;
+
+            if (pixelIndex != 0) {
+                // Check if SpriteZero is being used
+                if (i == 0 && _spriteZeroOnScanLine) {
+                    _spriteZeroUsed = true;
+                }
+                break;
+            }
+        }
+    }
+}
+
+void Ppu::_getSpriteFromLineBuffer(uint8_t& pixelIndex, uint8_t& paletteIndex, bool& priority)
+{
+    auto sprite = _spriteLine[_cycles - 1];
+    pixelIndex = sprite & spriteLinePixelMask;
+    priority = !(sprite & spriteLineBehindBackground);
+
+    // Add 0x04 since this is on sprite palette table
+    paletteIndex = ((sprite & spriteLinePaletteMask) >> spriteLinePaletteShift) + 0x04;
+
+    if (sprite & spriteLineSpriteZero) {
+        _spriteZeroUsed = true;
+    }
+}
+
+void Ppu::_rasterizeSpriteLine()
+{
+    memset(_spriteLine, 0, sizeof(_spriteLine));
+
+    // Lower sprite slots have priority, so a pixel only gets taken by the first
+    // opaque sprite covering it. This mirrors the shift register model where
+    // a sprite at X starts shifting out its pattern at pixel X-1.
+    for (uint8_t i = 0; i < PPU_MAX_SPRITES_SECONDARY; i++) {
+        auto lowTile = shiftRegisterLowSpriteTile[i];
+        auto highTile = shiftRegisterHighSpriteTile[i];
+        if ((lowTile | highTile) == 0) {
+            // Fully transparent sprite
+            continue;
+        }
+
+        SpriteAttributeFlags spriteAttribute = *((SpriteAttributeFlags*)&_spriteAttribute[i]);
+        auto attributes = static_cast<uint8_t>(spriteAttribute.spritePaletteIndex << spriteLinePaletteShift);
+        if (spriteAttribute.isBehindBackground) {
+            attributes |= spriteLineBehindBackground;
+        }
+        if (i == 0 && _spriteZeroOnScanLine) {
+            attributes |= spriteLineSpriteZero;
+        }
+
+        for (int16_t column = 0; column < 8; column++) {
+            auto x = static_cast<int16_t>(_spritePositionX[i]) - 1 + column;
+            if ((x < 0) || (x >= PPU_FRAME_WIDTH) || (_spriteLine[x] & spriteLinePixelMask)) {
+                continue;
+            }
+            auto pixel = (((highTile >> (7 - column)) & 0x01) << 1) | ((lowTile >> (7 - column)) & 0x01);
+            if (pixel != 0) {
+                _spriteLine[x] = attributes | pixel;
+            }
+        }
+    }
+}
+
 void Ppu::writeOAMData(uint8_t address, uint8_t data)
 {
     uint8_t* OAMData = reinterpret_cast<uint8_t*>(_sprites);
     OAMData[address] = data;
 }
 
-void Ppu::readOAMData(uint8_t address, uint8_t& data)
+void Ppu::readOAMData(uint8_t address, uint8_t& data) const
 {
-    uint8_t* OAMData = reinterpret_cast<uint8_t*>(_sprites);
+    auto OAMData = reinterpret_cast<const uint8_t*>(_sprites);
     data = OAMData[address];
 }
 
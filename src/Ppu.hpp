@@ -2,6 +2,7 @@
 
 #include <stdio.h>
 #include <functional>
+#include <memory>
 #include <vector>
 #include <string>
 #include <array>
@@ -18,6 +19,8 @@
 #define PPU_MAX_SPRITES 64
 #define PPU_MAX_SPRITES_SECONDARY 8
 
+#define PPU_PALETTE_SIZE 32
+
 enum class PpuRegisterAddress {
     Control,
     Mask,
@@ -103,16 +106,20 @@ struct Pixel {
     uint8_t blue;
 };
 
-struct Tile {
-    Pixel pixel[8 * 8];
-};
-
-struct PatternTableTile {
-    Tile tile[16 * 16];
-};
-
-struct NameTableTile {
-    Tile tile[32 * 30];
+// A frame as emitted by the PPU: one 6-bit NES color index per pixel, plus the
+// PPUMASK color emphasis bits (bit0 red, bit1 green, bit2 blue) of every
+// scanline. Conversion to RGB is left to FrameConverter.
+//
+// Scanlines that are identical to the previous frame are flagged, so that
+// consumers can skip work for unchanged lines. The flags only hold against
+// the frame with the previous sequence number.
+struct PpuFrame {
+    uint8_t pixels[PPU_FRAME_BUFFER_SIZE];
+    uint8_t emphasis[PPU_FRAME_HEIGHT];
+    // Non-zero for scanlines that changed since the previous frame
+    uint8_t dirtyLines[PPU_FRAME_HEIGHT];
+    // Counts the frames with pixel output (see Ppu::setPixelOutput)
+    uint32_t sequence;
 };
 
 // The OAM (Object Attribute Memory) is internal memory inside the PPU that
@@ -137,6 +144,18 @@ struct SpriteInformation {
     uint8_t positionX;
 };
 
+// How sprite pixels are produced while rendering a scanline
+enum class SpriteRenderMode {
+    // Eight X down-counters and shift registers stepped on every pixel, just
+    // like the hardware does. This is the reference model.
+    ShiftRegisters,
+    // The sprites of a scanline are rasterized once, at the end of the sprite
+    // fetches, into a line buffer that is looked up on every pixel.
+    LineBuffer,
+};
+
+class PpuDebug;
+
 class Ppu {
 public:
     Ppu(std::shared_ptr<IDevice> bus, std::shared_ptr<Cartridge> cartridge);
@@ -149,23 +168,58 @@ public:
     void tick();
     void reset();
 
-    // Get Frame Buffer
-    uint8_t* getFrameBuffer();
+    /// Execute up to a number of clock cycles. Stretches where the PPU does
+    /// nothing but count (VBlank, or rendering disabled) are skipped at once.
+    /// @param cycles - maximum number of clock cycles to execute
+    /// @return number of clock cycles executed, it stops early right after
+    ///         VBlank NMI is triggered or the frame is done
+    uint32_t advance(uint32_t cycles);
+
+    /// Number of tick() calls until the next event the CPU can observe without
+    /// touching a PPU register: the VBlank NMI or the end of the frame
+    uint32_t getCyclesToNextEvent() const;
+
+    /// Read PPUSTATUS ($2002) as it is going to be after a number of tick()
+    /// calls, without running them. Only possible when nothing but a
+    /// predicted sprite zero hit can change the status in between.
+    /// @param cycles - number of tick() calls the PPU is behind
+    /// @param data - status read
+    /// @return false if the PPU has to catch up before the read
+    bool readStatusAhead(uint32_t cycles, uint8_t& data);
+
+    // Get palette-indexed Frame
+    const PpuFrame& getFrame() const { return _frame; }
     bool isFrameDone();
     bool isVBlankTriggered();
 
+    // Sprite rendering model
+    void setSpriteRenderMode(SpriteRenderMode mode) { _spriteRenderMode = mode; }
+    SpriteRenderMode getSpriteRenderMode() const { return _spriteRenderMode; }
+
+    /// Stop writing pixels into the frame, e.g. for frames nobody is going to
+    /// see. Everything the CPU can observe (sprite zero hit included) still
+    /// behaves the same.
+    void setPixelOutput(bool enabled) { _isPixelOutputEnabled = enabled; }
+    bool isPixelOutputEnabled() const { return _isPixelOutputEnabled; }
+
+    // NES color index of an entry in palette RAM
+    uint8_t getPaletteColor(uint8_t pixelIndex, uint8_t paletteIndex) const;
+
+    /// Debug views of pattern tables, name tables, OAM and palettes,
+    /// allocated on first use. Only for the thread running the PPU, other
+    /// threads get copies through Nes::setDebugViewsEnabled().
+    PpuDebug& getDebug();
+
     // OAM Interface
     void writeOAMData(uint8_t address, uint8_t data);
-    void readOAMData(uint8_t address, uint8_t& data);
+    void readOAMData(uint8_t address, uint8_t& data) const;
     void clearSecondaryOAMData(uint8_t data);
 
     // PPU registers
     PpuRegister registers;
 
 private:
-    PatternTableTile _getPatternTableTile(uint8_t type, uint8_t paletteIndex);
-    Pixel _getPixelPaletteTable(uint8_t pixelIndex, uint8_t paletteIndex);
-    NameTableTile _getNameTableTile(uint8_t index);
+    void _updatePaletteColor(uint16_t address);
 
     void _incrementVramHorizontalInfo();
     void _incrementVramVerticalInfo();
@@ -177,7 +231,20 @@ private:
     void _loadShiftRegisters();
     void _moveShiftRegisters();
     void _getIndexFromShiftRegisters(uint8_t& pixelIndex, uint8_t& paletteIndex);
+    void _getSpriteFromShiftRegisters(uint8_t& pixelIndex, uint8_t& paletteIndex, bool& priority);
+    void _getSpriteFromLineBuffer(uint8_t& pixelIndex, uint8_t& paletteIndex, bool& priority);
+    void _rasterizeSpriteLine();
+    void _evaluateSprites();
+    void _evaluateSpritesAVX2();
     void _flipBits(uint8_t& byte);
+    bool _isRenderingEnabled() const { return registers.maskFlag.showBackground || registers.maskFlag.showSprites; }
+    uint32_t _getIdleCycles() const;
+    void _predictSpriteZeroHit();
+    bool _isBackgroundOpaque(uint16_t x);
+    void _skipIdleCycles(uint32_t cycles);
+    void _startFrameLine(uint32_t scanLine);
+
+    bool _hasAVX2{false};
 
     uint16_t _cycles = 0;
     uint16_t _scanLine = 0;
@@ -203,10 +270,13 @@ private:
     // NES Catridge
     std::shared_ptr<Cartridge> _cartridge;
 
-    uint8_t _frameBufferRGB[PPU_FRAME_BUFFER_RGB_SIZE];
-    std::vector<Pixel> _paletteTablePixel;
-    std::array<PatternTableTile, 2> _patternTablePixel;
-    std::array<NameTableTile, 4> _nameTablePixel;
+    PpuFrame _frame;
+
+    // Resolved copy of palette RAM, refreshed on palette writes only
+    uint8_t _paletteColors[PPU_PALETTE_SIZE];
+
+    // Debug views, only allocated when asked for
+    std::unique_ptr<PpuDebug> _debug;
 
     // Sprites
     SpriteInformation _sprites[PPU_MAX_SPRITES];
@@ -215,9 +285,21 @@ private:
     bool _spriteZeroNextScanLine{false};
     bool _spriteZeroOnScanLine{false};
     bool _spriteZeroUsed{false};
+
+    // Sprite zero hit prediction for the next scanline, positions are counted
+    // in cycles from the start of the frame
+    bool _spriteZeroPredicted{false};
+    uint32_t _spriteZeroHitPosition{0};
+    uint32_t _spriteZeroPredictionEnd{0};
     uint16_t _spritePatternAddress{0x0000};
     uint8_t shiftRegisterLowSpriteTile[PPU_MAX_SPRITES_SECONDARY];
     uint8_t shiftRegisterHighSpriteTile[PPU_MAX_SPRITES_SECONDARY];
     uint8_t _spriteAttribute[PPU_MAX_SPRITES_SECONDARY];
     uint8_t _spritePositionX[PPU_MAX_SPRITES_SECONDARY];
+
+    // Sprite line buffer: pixel, palette, priority and sprite zero flag of
+    // every pixel of the next scanline
+    SpriteRenderMode _spriteRenderMode{SpriteRenderMode::LineBuffer};
+    bool _isPixelOutputEnabled{true};
+    uint8_t _spriteLine[PPU_FRAME_WIDTH];
 };
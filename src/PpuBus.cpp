@@ -1,12 +1,61 @@
 #include "PpuBus.hpp"
 
-PpuBus::PpuBus(std::shared_ptr<IMemory> nameTable,
+PpuBus::PpuBus(std::shared_ptr<NameTable> nameTable,
                std::shared_ptr<IMemory> paletteTable,
                std::shared_ptr<Cartridge> cartridge)
 : _nameTable{nameTable}
 , _paletteTable{paletteTable}
 , _cartridge{cartridge}
 {
+    _updateNameTablePages(_cartridge->getMirroringMode());
+    _cartridge->setMirroringCallback([this](MirroringMode mirroringMode) { _updateNameTablePages(mirroringMode); });
+}
+
+PpuBus::~PpuBus()
+{
+    _cartridge->setMirroringCallback(nullptr);
+}
+
+void PpuBus::_updateNameTablePages(MirroringMode mirroringMode)
+{
+    switch (mirroringMode) {
+    case MirroringMode::Vertical:
+        // Vertical Mirroring (used for horizontal scrolling)
+        // In this mode, we only use table1 (0x2000) and table2 (0x2400),
+        // table3 (0x2800) and table4 (0x2C00) are mirrors of table1 and
+        // table2, respectively.
+        _nameTablePages[0] = _nameTable->getPage(0);
+        _nameTablePages[1] = _nameTable->getPage(1);
+        _nameTablePages[2] = _nameTable->getPage(0);
+        _nameTablePages[3] = _nameTable->getPage(1);
+        break;
+    case MirroringMode::Horizontal:
+        // Horizontal Mirroring (used for vertical scrolling)
+        // In this mode, we only use table1 (0x2000) and table3 (0x2800),
+        // table2 (0x2400) and table4 (0x2C00) are mirrors of table1 and
+        // table3, respectively.
+        _nameTablePages[0] = _nameTable->getPage(0);
+        _nameTablePages[1] = _nameTable->getPage(0);
+        _nameTablePages[2] = _nameTable->getPage(2);
+        _nameTablePages[3] = _nameTable->getPage(2);
+        break;
+    case MirroringMode::OneScreenLow:
+    case MirroringMode::OneScreenHigh:
+    {
+        // All four tables are mirrors of a single table
+        auto page = (mirroringMode == MirroringMode::OneScreenLow) ? 0 : 1;
+        for (uint8_t table = 0; table < NAME_TABLE_NUM_PAGES; table++) {
+            _nameTablePages[table] = _nameTable->getPage(page);
+        }
+        break;
+    }
+    case MirroringMode::FourScreen:
+        // Every table has its own memory
+        for (uint8_t table = 0; table < NAME_TABLE_NUM_PAGES; table++) {
+            _nameTablePages[table] = _nameTable->getPage(table);
+        }
+        break;
+    }
 }
 
 bool PpuBus::read(uint16_t address, uint8_t& data)
@@ -15,28 +64,10 @@ bool PpuBus::read(uint16_t address, uint8_t& data)
     case patternTableBaseAddress ... patternTableEndAddress:
         return _cartridge->readCHR(address, data);
     case nameTableBaseAddress ... nameTableEndAddress:
-    {
-        auto newAddress{address};
-        if (_cartridge->getMirroringMode() == MirroringMode::Vertical) {
-            // Vertical Mirroring (used for horizontal scrolling)
-            // In this mode, we only use table1 (0x2000) and table2 (0x2400),
-            // any read to table3 (0x2800) and table4 (0x2C00) will be
-            // mirrored from table1 and table2, respectively.
-            if ((address >= nameTable3StartAddress) && (address <= nameTable4EndAddress)) {
-                newAddress = address - (nameTable3StartAddress - nameTable1StartAddress);
-            }
-        } else if (_cartridge->getMirroringMode() == MirroringMode::Horizontal) {
-            // Horizontal Mirroring (used for vertical scrolling)
-            // In this mode, we only use table1 (0x2000) and table3 (0x2800),
-            // any read to table2 (0x2400) and table4 (0x2C00) will be
-            // mirrored from table1 and table3, respectively.
-            if (((address >= nameTable2StartAddress) && (address <= nameTable2EndAddress)) ||
-                ((address >= nameTable4StartAddress) && (address <= nameTable4EndAddress))) {
-                newAddress = address - (nameTable2StartAddress - nameTable1StartAddress);
-            }
-        }
-        return _nameTable->read(newAddress, data);
-    }
+        // Bit10/11 selects which nametable, and 0x3000-0x3EFF mirrors
+        // 0x2000-0x2EFF
+        data = _nameTablePages[(address >> 10) & 0x03][address & (NAME_TABLE_PAGE_SIZE - 1)];
+        return true;
     case paletteTableBaseAddress ... paletteTableEndAddress:
     {
         auto newAddress{address};
@@ -60,28 +91,8 @@ bool PpuBus::write(uint16_t address, uint8_t data)
     case patternTableBaseAddress ... patternTableEndAddress:
         return _cartridge->writeCHR(address, data);
     case nameTableBaseAddress ... nameTableEndAddress:
-    {
-        auto newAddress{address};
-        if (_cartridge->getMirroringMode() == MirroringMode::Vertical) {
-            // Vertical Mirroring (used for horizontal scrolling)
-            // In this mode, we only use table1 (0x2000) and table2 (0x2400),
-            // any writes to table3 (0x2800) and table4 (0x2C00) will be
-            // mirrored to table1 and table2, respectively.
-            if ((address >= nameTable3StartAddress) && (address <= nameTable4EndAddress)) {
-                newAddress = address - (nameTable3StartAddress - nameTable1StartAddress);
-            }
-        } else if (_cartridge->getMirroringMode() == MirroringMode::Horizontal) {
-            // Horizontal Mirroring (used for vertical scrolling)
-            // In this mode, we only use table1 (0x2000) and table3 (0x2800),
-            // any writes to table2 (0x2400) and table4 (0x2C00) will be
-            // mirrored to table1 and table3, respectively.
-            if (((address >= nameTable2StartAddress) && (address <= nameTable2EndAddress)) ||
-                ((address >= nameTable4StartAddress) && (address <= nameTable4EndAddress))) {
-                newAddress = address - (nameTable2StartAddress - nameTable1StartAddress);
-            }
-        }
-        return _nameTable->write(newAddress, data);
-    }
+        _nameTablePages[(address >> 10) & 0x03][address & (NAME_TABLE_PAGE_SIZE - 1)] = data;
+        return true;
     case paletteTableBaseAddress ... paletteTableEndAddress:
     {
         auto newAddress{address};
@@ -5,6 +5,7 @@
 #include "IDevice.hpp"
 #include "IMemory.hpp"
 #include "Cartridge.hpp"
+#include "NameTable.hpp"
 
 constexpr auto patternTableBaseAddress = 0x0000;
 constexpr auto patternTableSpriteAddress = 0x0000;
@@ -37,9 +38,10 @@ constexpr auto paletteTableEndAddress = 0x3FFF;
 
 class PpuBus : public IDevice {
 public:
-    PpuBus(std::shared_ptr<IMemory> nameTable,
+    PpuBus(std::shared_ptr<NameTable> nameTable,
            std::shared_ptr<IMemory> paletteTable,
            std::shared_ptr<Cartridge> cartridge);
+    ~PpuBus();
 
     /// @name Implementation IDevice
     /// @[
@@ -47,9 +49,15 @@ public:
     bool write(uint16_t address, uint8_t data);
     /// @]
 private:
+    void _updateNameTablePages(MirroringMode mirroringMode);
+
     // Memories attached to this Ppu Bus
-    std::shared_ptr<IMemory> _nameTable;
+    std::shared_ptr<NameTable> _nameTable;
     std::shared_ptr<IMemory> _paletteTable;
 
     std::shared_ptr<Cartridge> _cartridge;
+
+    // Nametable page backing each of the four 1KB nametable slots, these
+    // pages follow the mirroring mode of the cartridge.
+    uint8_t* _nameTablePages[NAME_TABLE_NUM_PAGES];
 };
@@ -0,0 +1,256 @@
+#include <string.h>
+
+#include "PpuDebug.hpp"
+#include "PpuBus.hpp"
+
+// Color of the visible screen outline in the name tables view
+constexpr uint8_t scrollOverlayColor = 0x16;
+
+PpuDebug::PpuDebug(const Ppu& ppu, std::shared_ptr<IDevice> bus, std::shared_ptr<Cartridge> cartridge)
+: _ppu{ppu}
+, _bus{bus}
+, _cartridge{cartridge}
+{
+    memset(_patternPixels, 0, sizeof(_patternPixels));
+    memset(_patternTables, 0, sizeof(_patternTables));
+    memset(_nameTables, 0, sizeof(_nameTables));
+    memset(_nameTablesView, 0, sizeof(_nameTablesView));
+    memset(_oam, 0, sizeof(_oam));
+    memset(_palettes, 0, sizeof(_palettes));
+    memset(_paletteColors, 0, sizeof(_paletteColors));
+}
+
+void PpuDebug::setPatternTablePalette(uint8_t paletteIndex)
+{
+    paletteIndex &= 0x07;
+    if (paletteIndex != _patternTablePalette) {
+        _patternTablePalette = paletteIndex;
+        _isPatternTablesDirty = true;
+    }
+}
+
+void PpuDebug::copyViews(PpuDebugViews& views) const
+{
+    memcpy(views.patternTables, _patternTables, sizeof(views.patternTables));
+    memcpy(views.nameTables, _nameTablesView, sizeof(views.nameTables));
+    memcpy(views.oam, _oam, sizeof(views.oam));
+    memcpy(views.palettes, _palettes, sizeof(views.palettes));
+}
+
+void PpuDebug::onVramWrite(uint16_t address)
+{
+    address &= 0x3FFF;
+    if (address < nameTable1StartAddress) {
+        // 16 bytes per tile in the Pattern Table
+        _dirtyPatternTiles.set(address / 16);
+    } else if (address < paletteTableBaseAddress) {
+        // Name tables are mirrored, let's mark the tile in all four of them
+        // rather than following the mirroring mode
+        auto offset = address & 0x03FF;
+        if (offset < PPU_DEBUG_NAME_TABLE_TILES) {
+            for (uint8_t table = 0; table < 4; table++) {
+                _dirtyNameTableTiles.set(table * PPU_DEBUG_NAME_TABLE_TILES + offset);
+            }
+        } else {
+            // One attribute byte covers 4x4 tiles
+            auto attribute = offset - PPU_DEBUG_NAME_TABLE_TILES;
+            auto tileX = (attribute % 8) * 4;
+            auto tileY = (attribute / 8) * 4;
+            for (uint16_t y = tileY; (y < tileY + 4) && (y < 30); y++) {
+                for (uint16_t x = tileX; x < tileX + 4; x++) {
+                    for (uint8_t table = 0; table < 4; table++) {
+                        _dirtyNameTableTiles.set(table * PPU_DEBUG_NAME_TABLE_TILES + y * 32 + x);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void PpuDebug::update()
+{
+    // Palette, mirroring or background pattern table changes affect a lot of
+    // tiles at once, so just redraw everything that depends on them
+    uint8_t paletteColors[PPU_PALETTE_SIZE];
+    for (uint8_t index = 0; index < PPU_PALETTE_SIZE; index++) {
+        paletteColors[index] = _ppu.getPaletteColor(index % 4, index / 4);
+    }
+    auto isPaletteChanged = memcmp(paletteColors, _paletteColors, sizeof(_paletteColors)) != 0;
+    memcpy(_paletteColors, paletteColors, sizeof(_paletteColors));
+
+    auto mirroringMode = _cartridge->getMirroringMode();
+    auto backgroundPatternTable = _ppu.registers.controlFlag.backgroundPatternTable;
+    auto isPatternTablesDirty = _isAllDirty || _isPatternTablesDirty || isPaletteChanged;
+    auto isNameTablesDirty = _isAllDirty || isPaletteChanged || (mirroringMode != _mirroringMode) ||
+                             (backgroundPatternTable != _backgroundPatternTable);
+    _mirroringMode = mirroringMode;
+    _backgroundPatternTable = backgroundPatternTable;
+
+    // Pattern tables
+    for (uint16_t tile = 0; tile < 2 * PPU_DEBUG_PATTERN_TABLE_TILES; tile++) {
+        if (_isAllDirty || _dirtyPatternTiles[tile]) {
+            _decodePatternTile(tile);
+        }
+        if (isPatternTablesDirty || _dirtyPatternTiles[tile]) {
+            _drawPatternTile(tile);
+        }
+    }
+
+    // Name tables, a tile also has to be redrawn when its pattern changed
+    auto isAnyPatternDirty = _dirtyPatternTiles.any();
+    auto patternBase = backgroundPatternTable ? PPU_DEBUG_PATTERN_TABLE_TILES : 0;
+    for (uint8_t table = 0; table < 4; table++) {
+        auto nameTableAddress = nameTable1StartAddress + table * 0x0400;
+        for (uint16_t tile = 0; tile < PPU_DEBUG_NAME_TABLE_TILES; tile++) {
+            auto isDirty = isNameTablesDirty || _dirtyNameTableTiles[table * PPU_DEBUG_NAME_TABLE_TILES + tile];
+            if (!isDirty && isAnyPatternDirty) {
+                auto patternIndex = uint8_t{0x00};
+                _bus->read(nameTableAddress + tile, patternIndex);
+                isDirty = _dirtyPatternTiles[patternBase + patternIndex];
+            }
+            if (isDirty) {
+                _drawNameTableTile(table, tile);
+            }
+        }
+    }
+    _drawScrollOverlay();
+
+    // OAM and palettes are tiny, always redraw them
+    _drawOAM();
+    memcpy(_palettes, _paletteColors, sizeof(_palettes));
+
+    _dirtyPatternTiles.reset();
+    _dirtyNameTableTiles.reset();
+    _isAllDirty = false;
+    _isPatternTablesDirty = false;
+}
+
+void PpuDebug::_decodePatternTile(uint16_t tile)
+{
+    // 8-byte for LSB and another 8-byte for MSB
+    for (uint8_t y = 0; y < 8; y++) {
+        auto lowByte = uint8_t{0x00};
+        auto highByte = uint8_t{0x00};
+        _bus->read(tile * 16 + y + 0, lowByte);
+        _bus->read(tile * 16 + y + 8, highByte);
+        for (uint8_t x = 0; x < 8; x++) {
+            auto lowBit = (lowByte >> (7 - x)) & 0x01;
+            auto highBit = (highByte >> (7 - x)) & 0x01;
+            _patternPixels[tile][y * 8 + x] = (highBit << 1) | lowBit;
+        }
+    }
+}
+
+void PpuDebug::_drawPatternTile(uint16_t tile)
+{
+    auto image = _patternTables[tile / PPU_DEBUG_PATTERN_TABLE_TILES];
+    auto index = tile % PPU_DEBUG_PATTERN_TABLE_TILES;
+    auto originX = (index % 16) * 8;
+    auto originY = (index / 16) * 8;
+    for (uint8_t y = 0; y < 8; y++) {
+        for (uint8_t x = 0; x < 8; x++) {
+            auto pixel = _patternPixels[tile][y * 8 + x];
+
+            // Transparent pixels show the universal background color
+            auto color = pixel ? _paletteColors[_patternTablePalette * 4 + pixel] : _paletteColors[0];
+            image[(originY + y) * PPU_DEBUG_PATTERN_TABLE_SIZE + originX + x] = color;
+        }
+    }
+}
+
+void PpuDebug::_drawNameTableTile(uint8_t table, uint16_t tile)
+{
+    auto nameTableAddress = nameTable1StartAddress + table * 0x0400;
+    auto tileX = tile % 32;
+    auto tileY = tile / 32;
+
+    auto patternIndex = uint8_t{0x00};
+    _bus->read(nameTableAddress + tile, patternIndex);
+
+    // Each attribute byte holds the 2-bit palettes of 4 2x2 tile blocks
+    auto attribute = uint8_t{0x00};
+    _bus->read(nameTableAddress + PPU_DEBUG_NAME_TABLE_TILES + (tileY / 4) * 8 + (tileX / 4), attribute);
+    auto shift = ((tileY % 4) / 2) * 4 + ((tileX % 4) / 2) * 2;
+    auto paletteIndex = (attribute >> shift) & 0x03;
+
+    auto patternBase = _backgroundPatternTable ? PPU_DEBUG_PATTERN_TABLE_TILES : 0;
+    auto pixels = _patternPixels[patternBase + patternIndex];
+    auto originX = (table % 2) * PPU_FRAME_WIDTH + tileX * 8;
+    auto originY = (table / 2) * PPU_FRAME_HEIGHT + tileY * 8;
+    for (uint8_t y = 0; y < 8; y++) {
+        for (uint8_t x = 0; x < 8; x++) {
+            auto pixel = pixels[y * 8 + x];
+            auto color = pixel ? _paletteColors[paletteIndex * 4 + pixel] : _paletteColors[0];
+            _nameTables[(originY + y) * PPU_DEBUG_NAME_TABLES_WIDTH + originX + x] = color;
+        }
+    }
+}
+
+void PpuDebug::_drawScrollOverlay()
+{
+    memcpy(_nameTablesView, _nameTables, sizeof(_nameTablesView));
+
+    // The screen starts at the temporary VRAM address plus fine X, which is
+    // what gets copied to the current VRAM address at the start of a frame
+    const auto& registers = _ppu.registers;
+    auto scrollX = registers.tempVramFlag.nameTableXAddress * PPU_FRAME_WIDTH +
+                   registers.tempVramFlag.coarseXScroll * 8 + registers.fineXScroll;
+    auto scrollY = registers.tempVramFlag.nameTableYAddress * PPU_FRAME_HEIGHT +
+                   registers.tempVramFlag.coarseYScroll * 8 + registers.tempVramFlag.fineYScroll;
+
+    // Outline wraps around the name tables just like scrolling does
+    for (uint16_t x = 0; x < PPU_FRAME_WIDTH; x++) {
+        auto column = (scrollX + x) % PPU_DEBUG_NAME_TABLES_WIDTH;
+        auto top = scrollY % PPU_DEBUG_NAME_TABLES_HEIGHT;
+        auto bottom = (scrollY + PPU_FRAME_HEIGHT - 1) % PPU_DEBUG_NAME_TABLES_HEIGHT;
+        _nameTablesView[top * PPU_DEBUG_NAME_TABLES_WIDTH + column] = scrollOverlayColor;
+        _nameTablesView[bottom * PPU_DEBUG_NAME_TABLES_WIDTH + column] = scrollOverlayColor;
+    }
+    for (uint16_t y = 0; y < PPU_FRAME_HEIGHT; y++) {
+        auto row = (scrollY + y) % PPU_DEBUG_NAME_TABLES_HEIGHT;
+        auto left = scrollX % PPU_DEBUG_NAME_TABLES_WIDTH;
+        auto right = (scrollX + PPU_FRAME_WIDTH - 1) % PPU_DEBUG_NAME_TABLES_WIDTH;
+        _nameTablesView[row * PPU_DEBUG_NAME_TABLES_WIDTH + left] = scrollOverlayColor;
+        _nameTablesView[row * PPU_DEBUG_NAME_TABLES_WIDTH + right] = scrollOverlayColor;
+    }
+}
+
+void PpuDebug::_drawOAM()
+{
+    memset(_oam, _paletteColors[0], sizeof(_oam));
+
+    const auto& registers = _ppu.registers;
+    auto height = registers.controlFlag.spriteSize ? 16 : 8;
+    for (uint8_t sprite = 0; sprite < PPU_MAX_SPRITES; sprite++) {
+        auto tileIndex = uint8_t{0x00};
+        auto attributes = uint8_t{0x00};
+        _ppu.readOAMData(sprite * 4 + 1, tileIndex);
+        _ppu.readOAMData(sprite * 4 + 2, attributes);
+        auto spriteAttribute = *reinterpret_cast<SpriteAttributeFlags*>(&attributes);
+
+        // Which tile of which pattern table, 8x16 sprites pick their table
+        // from bit0 of the tile index
+        auto firstTile = uint16_t{tileIndex};
+        if (height == 16) {
+            firstTile = (tileIndex & 0x01) * PPU_DEBUG_PATTERN_TABLE_TILES + (tileIndex & 0xFE);
+        } else if (registers.controlFlag.spritePatternTable) {
+            firstTile += PPU_DEBUG_PATTERN_TABLE_TILES;
+        }
+
+        // Add 0x04 since this is on sprite palette table
+        auto paletteIndex = spriteAttribute.spritePaletteIndex + 0x04;
+        auto originX = (sprite % 8) * 8;
+        auto originY = (sprite / 8) * 16;
+        for (uint8_t y = 0; y < height; y++) {
+            auto row = spriteAttribute.isVerticalFlip ? (height - 1 - y) : y;
+            auto pixels = _patternPixels[firstTile + row / 8];
+            for (uint8_t x = 0; x < 8; x++) {
+                auto column = spriteAttribute.isHorizontalFlip ? (7 - x) : x;
+                auto pixel = pixels[(row % 8) * 8 + column];
+                if (pixel) {
+                    _oam[(originY + y) * PPU_DEBUG_OAM_WIDTH + originX + x] = _paletteColors[paletteIndex * 4 + pixel];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <bitset>
+
+#include "IDevice.hpp"
+#include "Cartridge.hpp"
+#include "Ppu.hpp"
+
+// Pattern table view: 16x16 tiles
+#define PPU_DEBUG_PATTERN_TABLE_SIZE 128
+#define PPU_DEBUG_PATTERN_TABLE_TILES 256
+
+// Name tables view: the four name tables laid out 2x2 like in VRAM
+#define PPU_DEBUG_NAME_TABLES_WIDTH (PPU_FRAME_WIDTH * 2)
+#define PPU_DEBUG_NAME_TABLES_HEIGHT (PPU_FRAME_HEIGHT * 2)
+#define PPU_DEBUG_NAME_TABLE_TILES (32 * 30)
+
+// OAM view: 8x8 grid of sprites, each cell is 8x16 to fit 8x16 sprites
+#define PPU_DEBUG_OAM_WIDTH (8 * 8)
+#define PPU_DEBUG_OAM_HEIGHT (8 * 16)
+
+// Palettes view: one pixel per palette RAM entry, background then sprites
+#define PPU_DEBUG_PALETTES_WIDTH 16
+#define PPU_DEBUG_PALETTES_HEIGHT 2
+
+// Copy of all the views at once, to hand them to another thread
+struct PpuDebugViews {
+    uint8_t patternTables[2][PPU_DEBUG_PATTERN_TABLE_SIZE * PPU_DEBUG_PATTERN_TABLE_SIZE];
+    uint8_t nameTables[PPU_DEBUG_NAME_TABLES_WIDTH * PPU_DEBUG_NAME_TABLES_HEIGHT];
+    uint8_t oam[PPU_DEBUG_OAM_WIDTH * PPU_DEBUG_OAM_HEIGHT];
+    uint8_t palettes[PPU_DEBUG_PALETTES_WIDTH * PPU_DEBUG_PALETTES_HEIGHT];
+};
+
+// Debug views of the PPU memory. All views are images of NES color indices,
+// like PpuFrame pixels, that FrameConverter::getPixel turns into RGB.
+//
+// The views are kept up-to-date incrementally: the Ppu reports every VRAM
+// write through PPUDATA, and update() only redraws the tiles touched since the
+// last call. A palette, mirroring or pattern table selection change redraws
+// the views affected. This keeps update() cheap enough to run every frame.
+//
+// These are big and only needed by debug viewers, so they live outside of the
+// Ppu and are only allocated once somebody asks for them (see Ppu::getDebug).
+class PpuDebug {
+public:
+    PpuDebug(const Ppu& ppu, std::shared_ptr<IDevice> bus, std::shared_ptr<Cartridge> cartridge);
+
+    /// Bring all views up-to-date
+    void update();
+
+    /// Select which of the 8 palettes the pattern tables are colored with
+    void setPatternTablePalette(uint8_t paletteIndex);
+
+    /// Pattern table view, PPU_DEBUG_PATTERN_TABLE_SIZE pixels square
+    /// @param type - 0 for the table at 0x0000, 1 for the table at 0x1000
+    const uint8_t* getPatternTable(uint8_t type) const { return _patternTables[type & 0x01]; }
+
+    /// Name tables view, with the visible screen outlined at the scroll position
+    const uint8_t* getNameTables() const { return _nameTablesView; }
+
+    /// OAM view, sprite n is in cell (n % 8, n / 8)
+    const uint8_t* getOAM() const { return _oam; }
+
+    /// Palettes view
+    const uint8_t* getPalettes() const { return _palettes; }
+
+    /// Copy all views as they are
+    void copyViews(PpuDebugViews& views) const;
+
+    /// Called by the Ppu on every VRAM write through PPUDATA
+    void onVramWrite(uint16_t address);
+
+private:
+    void _decodePatternTile(uint16_t tile);
+    void _drawPatternTile(uint16_t tile);
+    void _drawNameTableTile(uint8_t table, uint16_t tile);
+    void _drawScrollOverlay();
+    void _drawOAM();
+
+    const Ppu& _ppu;
+
+    // Bus device attached to the Ppu
+    std::shared_ptr<IDevice> _bus;
+
+    // NES Catridge
+    std::shared_ptr<Cartridge> _cartridge;
+
+    // 2-bit pixels of every CHR tile, decoded once per CHR change
+    uint8_t _patternPixels[2 * PPU_DEBUG_PATTERN_TABLE_TILES][8 * 8];
+
+    // Views
+    uint8_t _patternTables[2][PPU_DEBUG_PATTERN_TABLE_SIZE * PPU_DEBUG_PATTERN_TABLE_SIZE];
+    uint8_t _nameTables[PPU_DEBUG_NAME_TABLES_WIDTH * PPU_DEBUG_NAME_TABLES_HEIGHT];
+    uint8_t _nameTablesView[PPU_DEBUG_NAME_TABLES_WIDTH * PPU_DEBUG_NAME_TABLES_HEIGHT];
+    uint8_t _oam[PPU_DEBUG_OAM_WIDTH * PPU_DEBUG_OAM_HEIGHT];
+    uint8_t _palettes[PPU_DEBUG_PALETTES_WIDTH * PPU_DEBUG_PALETTES_HEIGHT];
+
+    // Dirty tracking since the last update()
+    std::bitset<2 * PPU_DEBUG_PATTERN_TABLE_TILES> _dirtyPatternTiles;
+    std::bitset<4 * PPU_DEBUG_NAME_TABLE_TILES> _dirtyNameTableTiles;
+    bool _isAllDirty{true};
+    bool _isPatternTablesDirty{false};
+
+    // State the views were last drawn with
+    uint8_t _patternTablePalette{0};
+    uint8_t _paletteColors[PPU_PALETTE_SIZE];
+    bool _backgroundPatternTable{false};
+    MirroringMode _mirroringMode{MirroringMode::Horizontal};
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// Lock-free ring buffer streaming elements from one producer thread to one
+// consumer thread. Each side only ever moves its own index, so neither of
+// them waits for the other. A full buffer refuses new elements rather than
+// overwriting the oldest ones.
+template <typename T>
+class RingBuffer {
+public:
+    /// @param capacity - rounded up to a power of two
+    explicit RingBuffer(uint32_t capacity)
+    {
+        auto size = uint32_t{1};
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _buffer.resize(size);
+        _mask = size - 1;
+    }
+
+    /// Producer: append up to count elements
+    /// @return number of elements appended
+    uint32_t push(const T* data, uint32_t count)
+    {
+        auto writeIndex = _writeIndex.load(std::memory_order_relaxed);
+        auto readIndex = _readIndex.load(std::memory_order_acquire);
+        auto available = static_cast<uint32_t>(_buffer.size()) - (writeIndex - readIndex);
+        if (count > available) {
+            count = available;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            _buffer[(writeIndex + i) & _mask] = data[i];
+        }
+        _writeIndex.store(writeIndex + count, std::memory_order_release);
+        return count;
+    }
+
+    /// Producer: append a single element
+    /// @return false if the buffer is full
+    bool push(const T& element) { return push(&element, 1) == 1; }
+
+    /// Consumer: take out up to count elements
+    /// @return number of elements taken out
+    uint32_t pop(T* data, uint32_t count)
+    {
+        auto readIndex = _readIndex.load(std::memory_order_relaxed);
+        auto writeIndex = _writeIndex.load(std::memory_order_acquire);
+        if (count > writeIndex - readIndex) {
+            count = writeIndex - readIndex;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            data[i] = _buffer[(readIndex + i) & _mask];
+        }
+        _readIndex.store(readIndex + count, std::memory_order_release);
+        return count;
+    }
+
+    /// Number of elements waiting, from either side
+    uint32_t getSize() const
+    {
+        // Read index first, the write index can only be ahead of it
+        auto readIndex = _readIndex.load(std::memory_order_acquire);
+        return _writeIndex.load(std::memory_order_acquire) - readIndex;
+    }
+
+    uint32_t getCapacity() const { return static_cast<uint32_t>(_buffer.size()); }
+
+private:
+    std::vector<T> _buffer;
+    uint32_t _mask{0};
+
+    // Free-running indices, they wrap around together with uint32_t. Each on
+    // a cache line of its own, so the two sides do not invalidate each other.
+    alignas(64) std::atomic<uint32_t> _writeIndex{0};
+    alignas(64) std::atomic<uint32_t> _readIndex{0};
+};
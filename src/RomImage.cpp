@@ -0,0 +1,93 @@
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "RomImage.hpp"
+
+// Images in use, by the hash of their content
+static std::mutex cacheMutex;
+static std::unordered_multimap<uint64_t, std::weak_ptr<const RomImage>> cache;
+static std::atomic<bool> isCacheEnabled{true};
+
+// 64-bit FNV-1a, plenty to tell ROMs apart, and the content is compared on a
+// match anyway
+static uint64_t getContentHash(const uint8_t* data, size_t size)
+{
+    auto hash = uint64_t{0xCBF29CE484222325};
+    for (size_t index = 0; index < size; index++) {
+        hash = (hash ^ data[index]) * 0x100000001B3;
+    }
+
+    return hash;
+}
+
+RomImage::RomImage(const uint8_t* data, size_t size)
+: _data{data}
+, _size{size}
+, _hash{getContentHash(data, size)}
+{
+}
+
+RomImage::~RomImage()
+{
+    munmap(const_cast<uint8_t*>(_data), _size);
+}
+
+std::shared_ptr<const RomImage> RomImage::load(const std::string& fileName)
+{
+    auto fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Failed to open ROM %s\n", fileName.c_str());
+        return nullptr;
+    }
+
+    struct stat fileStat;
+    if ((fstat(fd, &fileStat) != 0) || (fileStat.st_size <= 0)) {
+        fprintf(stderr, "Failed to get the size of ROM %s\n", fileName.c_str());
+        close(fd);
+        return nullptr;
+    }
+
+    // The mapping keeps the file, the descriptor is not needed any more
+    auto size = static_cast<size_t>(fileStat.st_size);
+    auto data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        fprintf(stderr, "Failed to map ROM %s\n", fileName.c_str());
+        return nullptr;
+    }
+
+    auto image = std::shared_ptr<const RomImage>(new RomImage(static_cast<const uint8_t*>(data), size));
+    if (!isCacheEnabled) {
+        return image;
+    }
+
+    std::lock_guard<std::mutex> lock{cacheMutex};
+    auto range = cache.equal_range(image->getHash());
+    for (auto entry = range.first; entry != range.second; entry++) {
+        auto cached = entry->second.lock();
+        if (cached && (cached->getSize() == size) && (memcmp(cached->getData(), image->getData(), size) == 0)) {
+            // Same game, the new mapping goes away with image
+            return cached;
+        }
+    }
+
+    // Forget images nobody uses any more
+    for (auto entry = cache.begin(); entry != cache.end();) {
+        entry = entry->second.expired() ? cache.erase(entry) : std::next(entry);
+    }
+    cache.emplace(image->getHash(), image);
+
+    return image;
+}
+
+void RomImage::setCacheEnabled(bool enabled)
+{
+    isCacheEnabled = enabled;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// Read-only image of a ROM file, mapped straight from the page cache instead
+// of being copied into memory of its own.
+//
+// Images are also shared through a process-wide cache, addressed by their
+// content: every instance loading the same game gets the same image, whatever
+// the file it came from. The cache only holds images that are in use.
+class RomImage {
+public:
+    ~RomImage();
+
+    RomImage(const RomImage&) = delete;
+    RomImage& operator=(const RomImage&) = delete;
+
+    /// Map a ROM file, or get the image already mapped with the same content
+    /// @return nullptr if the file could not be mapped
+    static std::shared_ptr<const RomImage> load(const std::string& fileName);
+
+    /// Whether load() shares images, on by default
+    static void setCacheEnabled(bool enabled);
+
+    const uint8_t* getData() const { return _data; }
+    size_t getSize() const { return _size; }
+    uint64_t getHash() const { return _hash; }
+
+private:
+    RomImage(const uint8_t* data, size_t size);
+
+    const uint8_t* _data{nullptr};
+    size_t _size{0};
+    uint64_t _hash{0};
+};
@@ -0,0 +1,243 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string.h>
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+#include "TimeStretch.hpp"
+
+// Segment length, longer than the period of the lowest notes so that their
+// waveforms can be lined up
+constexpr uint32_t segmentMilliseconds = 12;
+
+// How far the search looks either side of the nominal position
+constexpr uint32_t searchMilliseconds = 8;
+
+TimeStretch::TimeStretch(uint32_t sampleRate)
+: _sampleRate{sampleRate}
+{
+    // Whole SIMD vectors in the similarity measure
+    _segmentSize = std::max((sampleRate * segmentMilliseconds / 1000 + 3) & ~3u, 4u);
+    _searchRange = sampleRate * searchMilliseconds / 1000;
+
+    // Raised cosine, the fade out of the previous segment is its complement
+    _fadeIn.resize(_segmentSize);
+    for (uint32_t index = 0; index < _segmentSize; index++) {
+        _fadeIn[index] = static_cast<float>(0.5 - 0.5 * cos(M_PI * (index + 0.5) / _segmentSize));
+    }
+
+    _output.resize(_segmentSize);
+    _outputPosition = _segmentSize;
+
+    // Coarse search steps that keep the search within budget, counting the
+    // coarse pass and the refinement around its best position
+    auto candidates = 2 * _searchRange + 1;
+    auto costPerCandidate = 2 * _segmentSize;
+    auto lowestCost = UINT32_MAX;
+    for (uint32_t step = 1; step <= candidates; step++) {
+        auto cost = (candidates / step + 2 * (step - 1)) * costPerCandidate;
+        if (cost < lowestCost) {
+            lowestCost = cost;
+            _searchStep = step;
+        }
+        if (cost <= TIME_STRETCH_SEARCH_BUDGET) {
+            break;
+        }
+    }
+}
+
+void TimeStretch::setSpeed(double speed)
+{
+    _speed = std::min(std::max(speed, TIME_STRETCH_MIN_SPEED), TIME_STRETCH_MAX_SPEED);
+}
+
+uint32_t TimeStretch::getInputChunk(double speed) const
+{
+    if (speed == 1.0) {
+        return 0;
+    }
+
+    // A segment's worth of input for the speed, plus the search past it
+    return static_cast<uint32_t>(ceil(_segmentSize * speed)) + _searchRange + _segmentSize;
+}
+
+uint32_t TimeStretch::readSamples(float* samples, uint32_t count)
+{
+    uint32_t numRead = 0;
+    while (numRead < count) {
+        // What is left of the last segment first
+        if (_outputPosition < _segmentSize) {
+            auto numCopied = std::min(count - numRead, _segmentSize - _outputPosition);
+            memcpy(samples + numRead, _output.data() + _outputPosition, numCopied * sizeof(float));
+            _outputPosition += numCopied;
+            numRead += numCopied;
+            continue;
+        }
+
+        auto speed = _speed.load();
+        if (speed == 1.0) {
+            // Straight through, carrying on from the natural continuation
+            _fillInput(_tailPosition + count - numRead);
+            auto numAvailable = std::min<uint64_t>(count - numRead, _inputStart + _input.size() - _tailPosition);
+            if (numAvailable == 0) {
+                break;
+            }
+            memcpy(samples + numRead, _input.data() + (_tailPosition - _inputStart), numAvailable * sizeof(float));
+            numRead += numAvailable;
+            _tailPosition += numAvailable;
+            _nominalPosition = static_cast<double>(_tailPosition);
+            _trimInput();
+            continue;
+        }
+
+        auto nominal = static_cast<uint64_t>(_nominalPosition);
+        if (!_fillInput(std::max(_tailPosition, nominal + _searchRange) + _segmentSize)) {
+            break;
+        }
+
+        // Only the stretching itself counts, not what the input costs
+        auto startTime = std::chrono::steady_clock::now();
+        _stretchSegment(speed);
+        std::chrono::duration<uint64_t, std::nano> elapsed = std::chrono::steady_clock::now() - startTime;
+        _processNanoseconds += elapsed.count();
+    }
+    _outputSamples += numRead;
+
+    return numRead;
+}
+
+TimeStretchStats TimeStretch::getStats() const
+{
+    TimeStretchStats stats;
+    stats.speed = _speed;
+    stats.segments = _segments;
+    stats.searchStep = _searchStep;
+
+    auto outputSeconds = static_cast<double>(_outputSamples) / _sampleRate;
+    stats.load = (outputSeconds > 0.0) ? (_processNanoseconds * 1e-9 / outputSeconds) : 0.0;
+    return stats;
+}
+
+void TimeStretch::resetStats()
+{
+    _segments = 0;
+    _processNanoseconds = 0;
+    _outputSamples = 0;
+}
+
+bool TimeStretch::_fillInput(uint64_t end)
+{
+    while (_inputStart + _input.size() < end) {
+        if (!_readSamples) {
+            return false;
+        }
+
+        auto size = _input.size();
+        auto missing = static_cast<uint32_t>(end - (_inputStart + size));
+        _input.resize(size + missing);
+        auto numRead = _readSamples(_input.data() + size, missing);
+        _input.resize(size + numRead);
+        if (numRead == 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void TimeStretch::_trimInput()
+{
+    // The search may still look back from the nominal position
+    auto nominal = static_cast<uint64_t>(_nominalPosition);
+    auto keep = std::min(_tailPosition, (nominal > _searchRange) ? nominal - _searchRange : 0);
+
+    // Moving the samples down is only worth it once in a while
+    if (keep >= _inputStart + _segmentSize) {
+        auto numDropped = std::min<uint64_t>(keep - _inputStart, _input.size());
+        _input.erase(_input.begin(), _input.begin() + numDropped);
+        _inputStart += numDropped;
+    }
+}
+
+void TimeStretch::_stretchSegment(double speed)
+{
+    auto best = _findBestPosition(static_cast<uint64_t>(_nominalPosition));
+
+    // Cross-fade from the continuation of the previous segment into the new one
+    auto tail = _input.data() + (_tailPosition - _inputStart);
+    auto segment = _input.data() + (best - _inputStart);
+    for (uint32_t index = 0; index < _segmentSize; index++) {
+        _output[index] = tail[index] + (segment[index] - tail[index]) * _fadeIn[index];
+    }
+    _outputPosition = 0;
+
+    _tailPosition = best + _segmentSize;
+    _nominalPosition += _segmentSize * speed;
+    _segments++;
+    _trimInput();
+}
+
+uint64_t TimeStretch::_findBestPosition(uint64_t nominal)
+{
+    auto first = std::max((nominal > _searchRange) ? nominal - _searchRange : 0, _inputStart);
+    auto last = nominal + _searchRange;
+    auto target = _input.data() + (_tailPosition - _inputStart);
+
+    // Nominal position wins ties, e.g. in silence
+    auto best = std::max(nominal, first);
+    auto bestSimilarity = _getSimilarity(_input.data() + (best - _inputStart), target);
+    auto check = [&](uint64_t position) {
+        auto similarity = _getSimilarity(_input.data() + (position - _inputStart), target);
+        if (similarity > bestSimilarity) {
+            bestSimilarity = similarity;
+            best = position;
+        }
+    };
+
+    // Coarse pass, then every position around the best one it found
+    for (auto position = first; position <= last; position += _searchStep) {
+        check(position);
+    }
+    if (_searchStep > 1) {
+        auto coarseBest = best;
+        auto refineFirst = std::max((coarseBest > first + _searchStep - 1) ? coarseBest - _searchStep + 1 : first, first);
+        auto refineLast = std::min(coarseBest + _searchStep - 1, last);
+        for (auto position = refineFirst; position <= refineLast; position++) {
+            check(position);
+        }
+    }
+
+    return best;
+}
+
+float TimeStretch::_getSimilarity(const float* candidate, const float* target)
+{
+    // Normalized cross-correlation, without the energy of the target which
+    // is the same for every candidate
+    float dot = 0.0f;
+    float energy = 0.0f;
+#if defined(__SSE__)
+    auto dots = _mm_setzero_ps();
+    auto energies = _mm_setzero_ps();
+    for (uint32_t index = 0; index < _segmentSize; index += 4) {
+        auto candidates = _mm_loadu_ps(candidate + index);
+        dots = _mm_add_ps(dots, _mm_mul_ps(candidates, _mm_loadu_ps(target + index)));
+        energies = _mm_add_ps(energies, _mm_mul_ps(candidates, candidates));
+    }
+    float sums[4];
+    _mm_storeu_ps(sums, dots);
+    dot = sums[0] + sums[1] + sums[2] + sums[3];
+    _mm_storeu_ps(sums, energies);
+    energy = sums[0] + sums[1] + sums[2] + sums[3];
+#else
+    for (uint32_t index = 0; index < _segmentSize; index++) {
+        dot += candidate[index] * target[index];
+        energy += candidate[index] * candidate[index];
+    }
+#endif
+
+    return dot / sqrtf(energy + 1e-9f);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <atomic>
+#include <functional>
+
+// Speeds the audio can be stretched to, and still sound like music
+#define TIME_STRETCH_MIN_SPEED 0.5
+#define TIME_STRETCH_MAX_SPEED 4.0
+
+// Multiply-adds the similarity search may spend per segment
+#define TIME_STRETCH_SEARCH_BUDGET (1 << 17)
+
+struct TimeStretchStats {
+    double speed;
+    // Segments put together, and how many candidate positions apart the
+    // coarse search looks
+    uint64_t segments;
+    uint32_t searchStep;
+    // Time spent putting segments together, search included, as a fraction
+    // of the audio time produced
+    double load;
+};
+
+// Changes the tempo of a stream of samples without changing its pitch, by
+// WSOLA (waveform similarity overlap-add).
+//
+// Output is put together from segments of the input, cross-faded into each
+// other. Each segment is taken around where the speed says the input should
+// be by now, shifted to where the input looks most like the natural
+// continuation of the previous segment, so the waveforms line up in the
+// cross-fade. At speed 1 samples are passed through untouched.
+//
+// Samples are pulled from the read samples callback as needed, on the thread
+// reading the output.
+class TimeStretch {
+public:
+    TimeStretch(uint32_t sampleRate);
+
+    /// Input samples consumed per output sample, clamped to
+    /// TIME_STRETCH_MIN_SPEED to TIME_STRETCH_MAX_SPEED. Any thread.
+    void setSpeed(double speed);
+    double getSpeed() const { return _speed; }
+
+    static bool isSupportedSpeed(double speed)
+    {
+        return (speed >= TIME_STRETCH_MIN_SPEED) && (speed <= TIME_STRETCH_MAX_SPEED);
+    }
+
+    /// Input samples the stretcher may pull at once at a speed, which the
+    /// source should have buffered
+    uint32_t getInputChunk(double speed) const;
+
+    void setReadSamplesCallback(std::function<uint32_t(float*, uint32_t)> callback) { _readSamples = callback; }
+
+    /// Take out stretched samples
+    /// @return number of samples read, short when the input ran out
+    uint32_t readSamples(float* samples, uint32_t count);
+
+    TimeStretchStats getStats() const;
+    void resetStats();
+
+private:
+    bool _fillInput(uint64_t end);
+    void _trimInput();
+    void _stretchSegment(double speed);
+    uint64_t _findBestPosition(uint64_t nominal);
+    float _getSimilarity(const float* candidate, const float* target);
+
+    uint32_t _sampleRate{0};
+
+    // Segments are cross-faded over their whole length, the search looks
+    // this many samples either side of the nominal position
+    uint32_t _segmentSize{0};
+    uint32_t _searchRange{0};
+    uint32_t _searchStep{1};
+    std::vector<float> _fadeIn;
+
+    // Input pulled so far, from the absolute sample index _inputStart
+    std::vector<float> _input;
+    uint64_t _inputStart{0};
+
+    // Natural continuation of the output so far, and where the input should
+    // be by now for the speed
+    uint64_t _tailPosition{0};
+    double _nominalPosition{0.0};
+
+    // Segment put together but not read yet
+    std::vector<float> _output;
+    uint32_t _outputPosition{0};
+
+    std::atomic<double> _speed{1.0};
+    std::function<uint32_t(float*, uint32_t)> _readSamples{nullptr};
+
+    // Statistics
+    std::atomic<uint64_t> _segments{0};
+    std::atomic<uint64_t> _processNanoseconds{0};
+    std::atomic<uint64_t> _outputSamples{0};
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free triple buffer handing whole objects from one producer thread to
+// one consumer thread. The producer always has a buffer of its own to write
+// into and the consumer always picks up the newest published one, so neither
+// of them ever waits for the other and nobody sees a half-written object.
+template <typename T>
+class TripleBuffer {
+public:
+    /// Producer: buffer to write the next object into
+    T& getWriteBuffer() { return _buffers[_writeIndex]; }
+
+    /// Producer: publish the write buffer, an object the consumer has not
+    /// picked up yet gets dropped
+    void publish()
+    {
+        auto previous = _middleIndex.exchange(_writeIndex | freshFlag, std::memory_order_acq_rel);
+        _writeIndex = previous & indexMask;
+    }
+
+    /// Consumer: pick up the newest published object
+    /// @return false if nothing was published since the last call
+    bool update()
+    {
+        if (!(_middleIndex.load(std::memory_order_relaxed) & freshFlag)) {
+            return false;
+        }
+        auto previous = _middleIndex.exchange(_readIndex, std::memory_order_acq_rel);
+        _readIndex = previous & indexMask;
+        return true;
+    }
+
+    /// Consumer: object picked up by the last update()
+    const T& getReadBuffer() const { return _buffers[_readIndex]; }
+
+private:
+    static constexpr uint8_t indexMask = 0x03;
+    static constexpr uint8_t freshFlag = 0x04;
+
+    T _buffers[3]{};
+
+    // Each index is owned by one side, the middle one is swapped atomically
+    // and flagged when it holds an object the consumer has not seen
+    uint8_t _writeIndex{0};
+    std::atomic<uint8_t> _middleIndex{1};
+    uint8_t _readIndex{2};
+};
@@ -1,25 +1,59 @@
 #include <fcntl.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 #include <unistd.h>
 #include <linux/joystick.h>
+#include <chrono>
 
 #include "GL/freeglut.h"
 #include "GL/glut.h"
 #include "GL/gl.h"
 
-#ifdef SIDEBAR
-#include "sidebar.h"
-#endif
-
 #include "Nes.hpp"
+#include "GLDisplay.hpp"
+#include "Image.hpp"
+#include "FileAudioSink.hpp"
+
+// Xlib macros clash with plain names (e.g. Status), keep it last
+#include "GL/glx.h"
 
 Nes nes;
 GLuint texture = 0;
+GLuint sidebarTexture = 0;
+
+// Shown on both sides of the NES screen, if loaded
+static Image sidebar;
+static std::string sidebarFile;
+
+// OpenGL 3.3 core presentation, unless the legacy path was asked for
+static std::unique_ptr<GLDisplay> display;
+static bool useLegacyGL = false;
+static int swapInterval = 1;
+static bool isNewFrame = false;
+
+// Sequence number of the frame on screen, frames that directly follow it
+// only need their dirty lines uploaded
+static uint32_t displayedSequence = 0;
+static bool hasDisplayedFrame = false;
+
+// Audio latency, see Nes::setAudioBuffer
+static int audioNumBlocks = 8;
+static int audioBlockSize = 512;
+static bool noAudio = false;
+static std::string audioFile;
+static bool deferredApu = false;
+
+// Frames to run without a window, 0 to open one
+static int headlessFrames = 0;
 static int joystickFD0 = -1;
 static int joystickFD1 = -1;
 
-std::vector<uint8_t> displayBuffer;
+// Pausing, either asked for or because nobody can see the window
+static bool isUserPaused = false;
+static bool isWindowHidden = false;
+
 static uint32_t displayWidth = 0;
 static uint32_t displayHeight = 0;
 
@@ -158,8 +192,54 @@ void mapKeysToController(uint8_t key, bool state)
     }
 }
 
+void idle();
+
+void updatePause()
+{
+    // No frames come while paused, so stop polling for them altogether
+    auto isPaused = isUserPaused || isWindowHidden;
+    nes.getFramePacer().setPaused(isPaused);
+    glutIdleFunc(isPaused ? nullptr : &idle);
+}
+
+void nextSpeed()
+{
+    static const char* speedNames[] = {"1x", "2x", "4x", "8x", "unlimited", "0.5x"};
+
+    auto speed = static_cast<int>(nes.getSpeed()) + 1;
+    if (speed > static_cast<int>(EmulationSpeed::Unlimited)) {
+        speed = static_cast<int>(EmulationSpeed::Normal);
+    }
+    nes.setSpeed(static_cast<EmulationSpeed>(speed));
+    fprintf(stdout, "Speed: %s\n", speedNames[speed]);
+}
+
+void toggleSlowMotion()
+{
+    auto isSlow = (nes.getSpeed() != EmulationSpeed::SlowMotion);
+    nes.setSpeed(isSlow ? EmulationSpeed::SlowMotion : EmulationSpeed::Normal);
+    fprintf(stdout, "Speed: %s\n", isSlow ? "0.5x" : "1x");
+}
+
 void readPressedKeys(unsigned char key, int x, int y)
 {
+    if (key == ' ') {
+        // Space toggles pause
+        isUserPaused = !isUserPaused;
+        updatePause();
+        return;
+    }
+    if ((key == 't') || (key == 'T')) {
+        // T cycles through the fast forward speeds
+        nextSpeed();
+        return;
+    }
+    if ((key == 'y') || (key == 'Y')) {
+        // Y toggles half speed
+        toggleSlowMotion();
+        return;
+    }
+
     // Key pressed
     mapKeysToController(static_cast<uint8_t>(key), true);
 }
@@ -182,129 +262,402 @@ void readReleasedSpecialKeys(int key, int x, int y)
     mapKeysToController(static_cast<uint8_t>(key), false);
 }
 
+std::string getResourcePath(const char* name)
+{
+    // Resources live in res/ next to the executable, or in the current directory
+    char path[PATH_MAX];
+    auto length = readlink("/proc/self/exe", path, sizeof(path) - 1);
+    if (length > 0) {
+        path[length] = '\0';
+        auto directory = std::string{path};
+        directory.erase(directory.find_last_of('/') + 1);
+        auto resourcePath = directory + "res/" + name;
+        if (access(resourcePath.c_str(), R_OK) == 0) {
+            return resourcePath;
+        }
+    }
+
+    return std::string{"res/"} + name;
+}
+
 void initializeDisplay()
 {
     displayHeight = nes.getHeight();
     displayWidth = nes.getWidth();
 
-#ifdef SIDEBAR
-    // If we have sidebar enabled, we add
-    // two extra width's on both sides.
-    displayWidth += 2 * sideBarWidth;
-    displayBuffer.resize(displayWidth * displayHeight * 3);
-#endif
+    if (!sidebarFile.empty()) {
+        if (sidebar.load(sidebarFile)) {
+            // Sidebar is added on both sides
+            displayWidth += 2 * sidebar.getWidth();
+        } else {
+            fprintf(stderr, "Sidebar image %s could not be loaded\n", sidebarFile.c_str());
+        }
+    }
 }
 
-uint8_t* getDisplayBuffer()
+GLuint createLegacyTexture(uint32_t width, uint32_t height, const uint8_t* pixels)
 {
-    uint8_t* nesFrameBuffer = nes.getFrameBuffer();
+    GLuint newTexture = 0;
+    glGenTextures(1, &newTexture);
+    glBindTexture(GL_TEXTURE_2D, newTexture);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, pixels);
+    return newTexture;
+}
 
-#ifdef SIDEBAR
-    uint32_t pixelIndex = 0;
-    for (uint32_t row = 0; row < nes.getHeight(); row++) {
-        // Left sidebar
-        for (uint32_t col = (row * sideBarWidth * 3); col < ((row + 1) * sideBarWidth * 3); col++) {
-            displayBuffer[pixelIndex++] = sideBar[col];
-        }
+void drawLegacyQuad(GLuint quadTexture, float left, float right)
+{
+    glBindTexture(GL_TEXTURE_2D, quadTexture);
 
-        // Main NES window
-        for (uint32_t col = (row * nes.getWidth() * 3); col < ((row + 1) * nes.getWidth() * 3); col++) {
-            displayBuffer[pixelIndex++] = nesFrameBuffer[col];
-        }
+    glBegin(GL_QUADS);
+    glTexCoord2f(0, 0);
+    glVertex3f(left, 1.0f, 0.0f);
+    glTexCoord2f(0, 1);
+    glVertex3f(left, -1.0f, 0.0f);
+    glTexCoord2f(1, 1);
+    glVertex3f(right, -1.0f, 0.0f);
+    glTexCoord2f(1, 0);
+    glVertex3f(right, 1.0f, 0.0f);
+    glEnd();
+}
 
-        // Right sidebar
-        for (uint32_t col = (row * sideBarWidth * 3); col < ((row + 1) * sideBarWidth * 3); col++) {
-            displayBuffer[pixelIndex++] = sideBar[col];
-        }
+// Dirty lines of the newest frame against the one on screen, nullptr if the
+// whole frame has to be redrawn
+const uint8_t* getDirtyLines()
+{
+    const auto& frame = nes.getFrame();
+    if (!hasDisplayedFrame || (frame.sequence != displayedSequence + 1)) {
+        return nullptr;
     }
+    return frame.dirtyLines;
+}
 
-    // Return this buffer to have the sidebar
-    nesFrameBuffer = displayBuffer.data();
-#endif
+// Calls back with every run of dirty lines, as first line and line count
+void forEachDirtyRange(const uint8_t* dirtyLines, std::function<void(uint32_t, uint32_t)> callback)
+{
+    auto line = uint32_t{0};
+    while (line < nes.getHeight()) {
+        if (dirtyLines && !dirtyLines[line]) {
+            line++;
+            continue;
+        }
 
-    return nesFrameBuffer;
+        auto firstLine = line;
+        while ((line < nes.getHeight()) && (!dirtyLines || dirtyLines[line])) {
+            line++;
+        }
+        callback(firstLine, line - firstLine);
+    }
 }
 
-void renderFrame()
+void setFrameDisplayed()
 {
-    nes.renderFrame();
+    displayedSequence = nes.getFrame().sequence;
+    hasDisplayedFrame = true;
+    isNewFrame = false;
+}
 
+void displayFrameLegacy()
+{
     glClearColor(1, 0, 0, 1);
     glClear(GL_COLOR_BUFFER_BIT);
     glLoadIdentity();
 
-    uint8_t* buffer = getDisplayBuffer();
-
     if (!texture) {
-        glGenTextures(1, &texture);
+        texture = createLegacyTexture(nes.getWidth(), nes.getHeight(), nes.getFrameBuffer());
+        if (sidebar.getWidth()) {
+            // Sidebar never changes, it is only uploaded once
+            sidebarTexture = createLegacyTexture(sidebar.getWidth(), sidebar.getHeight(), sidebar.getPixels());
+        }
+        setFrameDisplayed();
+    } else if (isNewFrame) {
+        auto pixels = nes.getFrameBuffer();
+        auto lineSize = nes.getWidth() * 3;
         glBindTexture(GL_TEXTURE_2D, texture);
+        forEachDirtyRange(getDirtyLines(), [&](uint32_t firstLine, uint32_t numLines) {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, firstLine, nes.getWidth(), numLines, GL_RGB, GL_UNSIGNED_BYTE,
+                            pixels + firstLine * lineSize);
+        });
+        setFrameDisplayed();
+    }
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glEnable(GL_TEXTURE_2D);
 
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, displayWidth, displayHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, buffer);
-    } else {
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, displayWidth, displayHeight, GL_RGB, GL_UNSIGNED_BYTE, buffer);
+    // NES screen in the middle, sidebars left and right of it
+    auto frameEdge = static_cast<float>(nes.getWidth()) / displayWidth;
+    if (sidebarTexture) {
+        drawLegacyQuad(sidebarTexture, -1.0f, -frameEdge);
+        drawLegacyQuad(sidebarTexture, frameEdge, 1.0f);
     }
+    drawLegacyQuad(texture, -frameEdge, frameEdge);
+    glutSwapBuffers();
+}
 
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, texture);
+void windowStatus(int state)
+{
+    // No point emulating frames nobody sees
+    isWindowHidden = (state == GLUT_HIDDEN) || (state == GLUT_FULLY_COVERED);
+    updatePause();
+}
 
-    glBegin(GL_QUADS);
-    glTexCoord2f(0, 0);
-    glVertex3f(-1.0f, 1.0f, 0.0f);
-    glTexCoord2f(0, 1);
-    glVertex3f(-1.0f, -1.0f, 0.0f);
-    glTexCoord2f(1, 1);
-    glVertex3f(1.0f, -1.0f, 0.0f);
-    glTexCoord2f(1, 0);
-    glVertex3f(1.0f, 1.0f, 0.0f);
-    glEnd();
+void displayFrame()
+{
+    if (!display) {
+        displayFrameLegacy();
+        return;
+    }
+
+    // Redraws without a new frame (e.g. the window got exposed) skip the
+    // upload, new frames only convert and upload the lines that changed
+    if (isNewFrame) {
+        auto dirtyLines = getDirtyLines();
+        auto pixels = display->mapFrame();
+        if (pixels) {
+            forEachDirtyRange(dirtyLines, [&](uint32_t firstLine, uint32_t numLines) {
+                nes.convertFrame(PixelFormat::BGRA8888, pixels, firstLine, numLines);
+            });
+            display->unmapFrame(dirtyLines);
+            setFrameDisplayed();
+        } else {
+            // Nothing was uploaded, the frame is still new: try again
+            glutPostRedisplay();
+        }
+    }
+
+    display->draw(glutGet(GLUT_WINDOW_WIDTH), glutGet(GLUT_WINDOW_HEIGHT));
     glutSwapBuffers();
 }
 
+void setSwapInterval(int interval)
+{
+    // Whichever of the swap control extensions the driver has
+    typedef void (*SwapIntervalEXT)(Display*, GLXDrawable, int);
+    typedef int (*SwapIntervalMESA)(unsigned int);
+    typedef int (*SwapIntervalSGI)(int);
+
+    auto swapIntervalEXT = reinterpret_cast<SwapIntervalEXT>(
+        glXGetProcAddressARB(reinterpret_cast<const GLubyte*>("glXSwapIntervalEXT")));
+    auto swapIntervalMESA = reinterpret_cast<SwapIntervalMESA>(
+        glXGetProcAddressARB(reinterpret_cast<const GLubyte*>("glXSwapIntervalMESA")));
+    auto swapIntervalSGI = reinterpret_cast<SwapIntervalSGI>(
+        glXGetProcAddressARB(reinterpret_cast<const GLubyte*>("glXSwapIntervalSGI")));
+    if (swapIntervalEXT) {
+        swapIntervalEXT(glXGetCurrentDisplay(), glXGetCurrentDrawable(), interval);
+    } else if (swapIntervalMESA) {
+        swapIntervalMESA(interval);
+    } else if (swapIntervalSGI) {
+        swapIntervalSGI(interval);
+    }
+}
+
+void idle()
+{
+    // Emulation runs on its own thread, only redraw once it completed a frame.
+    // Otherwise nap a little, instead of spinning on the next frame.
+    if (nes.updateFrame()) {
+        auto dirtyLines = getDirtyLines();
+        auto isChanged = isNewFrame || !dirtyLines;
+        for (uint32_t line = 0; !isChanged && (line < nes.getHeight()); line++) {
+            isChanged = dirtyLines[line];
+        }
+
+        if (isChanged) {
+            isNewFrame = true;
+            glutPostRedisplay();
+        } else {
+            // Same picture as on screen, no need to upload or present it
+            setFrameDisplayed();
+        }
+    } else {
+        usleep(1000);
+    }
+}
+
+void printFramePacing()
+{
+    auto stats = nes.getFramePacer().getStats();
+    fprintf(stdout, "Frames: %llu, resyncs: %llu, max jitter: %llu us\n",
+            static_cast<unsigned long long>(stats.frames), static_cast<unsigned long long>(stats.resyncs),
+            static_cast<unsigned long long>(stats.maxJitter / 1000));
+    for (uint8_t bucket = 0; bucket < FRAME_PACER_HISTOGRAM_SIZE; bucket++) {
+        if (framePacerBucketLimits[bucket] == UINT32_MAX) {
+            fprintf(stdout, "  jitter >= %4u us: %llu\n", framePacerBucketLimits[bucket - 1],
+                    static_cast<unsigned long long>(stats.histogram[bucket]));
+        } else {
+            fprintf(stdout, "  jitter  < %4u us: %llu\n", framePacerBucketLimits[bucket],
+                    static_cast<unsigned long long>(stats.histogram[bucket]));
+        }
+    }
+}
+
+void printAudioStats()
+{
+    auto stats = nes.getAudioStats();
+    fprintf(stdout, "Audio buffer: %u samples (target %u, min %u, max %u), rate correction: %+.3f%%\n",
+            stats.bufferedSamples, stats.targetSamples, stats.minBufferedSamples, stats.maxBufferedSamples,
+            stats.rateCorrection * 100.0);
+    fprintf(stdout, "  underruns: %llu, dropped samples: %llu, dropped events: %llu\n",
+            static_cast<unsigned long long>(stats.underruns), static_cast<unsigned long long>(stats.droppedSamples),
+            static_cast<unsigned long long>(stats.droppedEvents));
+
+    auto timeStretchStats = nes.getTimeStretchStats();
+    if (timeStretchStats.segments > 0) {
+        fprintf(stdout, "Time stretch: %llu segments, search step %u, load %.2f%%\n",
+                static_cast<unsigned long long>(timeStretchStats.segments), timeStretchStats.searchStep,
+                timeStretchStats.load * 100.0);
+    }
+}
+
+void runHeadless()
+{
+    // As fast as possible, every frame in full
+    auto startTime = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < headlessFrames; frame++) {
+        nes.renderFrame();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+    fprintf(stdout, "Frames: %d in %.3f s, %.1f fps\n", headlessFrames, elapsed.count(),
+            headlessFrames / elapsed.count());
+    printAudioStats();
+}
+
+void closeWindow()
+{
+    // GL objects go while their context is still around
+    display.reset();
+}
+
 void help()
 {
-    fprintf(stdout, "Usage:   marknes rom_file\n");
+    fprintf(stdout, "Usage:   marknes [options] rom_file\n");
     fprintf(stdout, "Example: marknes roms/supermario.nes\n");
+    fprintf(stdout, "Options:\n");
+    fprintf(stdout, "  --legacy-gl         draw with the fixed function OpenGL pipeline\n");
+    fprintf(stdout, "  --swap-interval N   frames to wait for on each buffer swap, 0 for no vsync\n");
+    fprintf(stdout, "  --sidebar FILE      binary PPM image shown on both sides of the screen\n");
+    fprintf(stdout, "  --no-sidebar        do not show the sidebar\n");
+    fprintf(stdout, "  --audio-blocks N    audio blocks queued to the device, 8 by default\n");
+    fprintf(stdout, "  --audio-block-size N\n");
+    fprintf(stdout, "                      samples per audio block, 512 by default\n");
+    fprintf(stdout, "  --no-audio          discard the audio\n");
+    fprintf(stdout, "  --deferred-apu      synthesize the audio on the audio thread\n");
+    fprintf(stdout, "  --record-audio FILE record the audio to a WAV file (.wav) or raw 16-bit PCM\n");
+    fprintf(stdout, "  --headless N        run N frames as fast as possible without a window, then exit\n");
 }
 
 int main(int argc, char** argv)
 {
-    if (argc <= 1) {
+#ifdef SIDEBAR
+    sidebarFile = getResourcePath("sidebar.ppm");
+#endif
+
+    auto nesRomFile = std::string{};
+    for (int arg = 1; arg < argc; arg++) {
+        if (strcmp(argv[arg], "--legacy-gl") == 0) {
+            useLegacyGL = true;
+        } else if ((strcmp(argv[arg], "--swap-interval") == 0) && (arg + 1 < argc)) {
+            swapInterval = atoi(argv[++arg]);
+        } else if ((strcmp(argv[arg], "--sidebar") == 0) && (arg + 1 < argc)) {
+            sidebarFile = argv[++arg];
+        } else if (strcmp(argv[arg], "--no-sidebar") == 0) {
+            sidebarFile.clear();
+        } else if ((strcmp(argv[arg], "--audio-blocks") == 0) && (arg + 1 < argc)) {
+            audioNumBlocks = atoi(argv[++arg]);
+        } else if ((strcmp(argv[arg], "--audio-block-size") == 0) && (arg + 1 < argc)) {
+            audioBlockSize = atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--no-audio") == 0) {
+            noAudio = true;
+        } else if (strcmp(argv[arg], "--deferred-apu") == 0) {
+            deferredApu = true;
+        } else if ((strcmp(argv[arg], "--record-audio") == 0) && (arg + 1 < argc)) {
+            audioFile = argv[++arg];
+        } else if ((strcmp(argv[arg], "--headless") == 0) && (arg + 1 < argc)) {
+            headlessFrames = atoi(argv[++arg]);
+        } else {
+            nesRomFile = argv[arg];
+        }
+    }
+    if (nesRomFile.empty()) {
         help();
         exit(EXIT_FAILURE);
     }
-
-    // Get a hold of the joystick inputs
-    joystickFD0 = open("/dev/input/js0", O_RDONLY | O_NONBLOCK);
-    joystickFD1 = open("/dev/input/js1", O_RDONLY | O_NONBLOCK);
+    if ((audioNumBlocks <= 0) || (audioBlockSize <= 0)) {
+        fprintf(stderr, "Audio blocks and block size must be positive\n");
+        exit(EXIT_FAILURE);
+    }
 
     fprintf(stdout, "Mark NES Emulator\n");
 
-    auto nesRomFile = std::string{argv[1]};
-    nes.load(nesRomFile);
+    if (!audioFile.empty()) {
+        nes.setAudioSink(std::make_shared<FileAudioSink>(audioFile, NES_AUDIO_SAMPLE_RATE,
+                                                         FileAudioSink::getFormat(audioFile)));
+    } else if (noAudio) {
+        nes.setAudioSink(std::make_shared<NullAudioSink>());
+    }
+    nes.setAudioBuffer(audioNumBlocks, audioBlockSize);
+    nes.setApuSyncMode(deferredApu ? ApuSyncMode::Deferred : ApuSyncMode::Immediate);
+    if (!nes.load(nesRomFile)) {
+        exit(EXIT_FAILURE);
+    }
     nes.reset();
 
+    if (headlessFrames > 0) {
+        runHeadless();
+        return EXIT_SUCCESS;
+    }
+
+    // Get a hold of the joystick inputs
+    joystickFD0 = open("/dev/input/js0", O_RDONLY | O_NONBLOCK);
+    joystickFD1 = open("/dev/input/js1", O_RDONLY | O_NONBLOCK);
+
     initializeDisplay();
 
     glutInit(&argc, argv);
-    glutInitDisplayMode(GLUT_SINGLE);
+    if (useLegacyGL) {
+        glutInitDisplayMode(GLUT_SINGLE);
+    } else {
+        glutInitContextVersion(3, 3);
+        glutInitContextProfile(GLUT_CORE_PROFILE);
+        glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA);
+    }
     glutInitWindowSize(displayWidth, displayHeight);
     glutInitWindowPosition(0, 0);
     glutSetOption(GLUT_ACTION_ON_WINDOW_CLOSE, GLUT_ACTION_CONTINUE_EXECUTION);
     glutCreateWindow(nes.getName());
+
+    if (!useLegacyGL) {
+        display = std::make_unique<GLDisplay>(nes.getWidth(), nes.getHeight());
+        if (!display->initialize()) {
+            exit(EXIT_FAILURE);
+        }
+        if (sidebar.getWidth()) {
+            display->setSidebar(sidebar.getPixels(), sidebar.getWidth(), sidebar.getHeight());
+        }
+        setSwapInterval(swapInterval);
+    }
+
     glutKeyboardFunc(&readPressedKeys);
     glutKeyboardUpFunc(&readReleasedKeys);
     glutSpecialFunc(&readPressedSpecialKeys);
     glutSpecialUpFunc(&readReleasedSpecialKeys);
     glutJoystickFunc(&joystick, 10);
-    glutDisplayFunc(&renderFrame);
-    glutIdleFunc(&renderFrame);
+    glutDisplayFunc(&displayFrame);
+    glutIdleFunc(&idle);
+    glutWindowStatusFunc(&windowStatus);
+    glutCloseFunc(&closeWindow);
+
+    nes.start();
     glutMainLoop();
+    nes.stop();
+    printFramePacing();
+    printAudioStats();
 
     if (joystickFD0 >= 0) {
         close(joystickFD0);